@@ -1,5 +1,6 @@
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 
 #include "juno.h"
 #include "wave.h"
@@ -31,6 +32,18 @@ void audio_play_sample(mono8 s)
 	tail = t;
 }
 
+void audio_play_block(void *unused, const mono8 *s, int n)
+{
+	while (n--)
+		audio_play_sample(*s++);
+}
+
+void audio_play_silence(void *unused, long n)
+{
+	while (n--)
+		audio_play_sample(0);
+}
+
 void audio_init(void)
 {
 	// PD6 is output
@@ -101,6 +114,43 @@ void audio_play_sample(mono8 s)
 #endif
 }
 
+void audio_play_block(void *unused, const mono8 *s, int n)
+{
+#if BIG_TARGET
+	unsigned char buf[256];
+	while (n > 0) {
+		int i, len = n < sizeof buf ? n : sizeof buf;
+		for (i = 0; i < len; ++i)
+			buf[i] = s[i] + 128;
+		fwrite(buf, 1, len, audiofile);
+		s += len;
+		n -= len;
+	}
+#else
+	while (n--)
+		audio_play_sample(*s++);
+#endif
+}
+
+void audio_play_silence(void *unused, long n)
+{
+#if BIG_TARGET
+	// raw output has no way to mark a gap, but we can at least write it
+	// from a buffer that is already filled
+	static unsigned char buf[256];
+	if (!buf[0])
+		memset(buf, 128, sizeof buf);
+	while (n > 0) {
+		int len = n < sizeof buf ? n : sizeof buf;
+		fwrite(buf, 1, len, audiofile);
+		n -= len;
+	}
+#else
+	while (n--)
+		audio_play_sample(0);
+#endif
+}
+
 void audio_init(void)
 {
 #if BIG_TARGET
@@ -3,10 +3,18 @@
 #ifndef _AUDIO_H_
 #define _AUDIO_H_
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 typedef signed char mono8;
 extern void audio_play_sample(mono8 s);
+extern void audio_play_block(void *ctx, const mono8 *s, int n);
+extern void audio_play_silence(void *ctx, long n);
 extern void audio_init(void);
 
+// generators (eg, build-voice) may be built with the rate of another target
+#ifndef SAMPLE_RATE
 #if BIG_TARGET
 # define SAMPLE_RATE 16000
 //#define SAMPLE_RATE_IS_POWER_OF_2 0
@@ -19,6 +27,10 @@ extern void audio_init(void);
 # define SAMPLE_RATE 8192
 //#define SAMPLE_RATE_IS_POWER_OF_2 1
 #endif
+#endif
 
+#ifdef __cplusplus
+}
+#endif
 
 #endif
@@ -1,484 +1,696 @@
+/* THIS FILE IS AUTO-GENERATED! DO NOT EDIT THIS FILE. */
+/* voicec voices/bob.txt 16000/250 24000/250 */
+
 #include <stdbool.h>
 
 #include "juno.h"
 #include "phonemes.h"
 #include "voice.h"
 
-// XXX we should have a routine that returns a complete "phoneme" object, including all the flags.
-// The flags are split out from each phoneme to reduce memory requirements
-// because they are the same for all phonemes of each type, but the code above
-// us doesn't have to know that.
+#if SAMPLE_RATE == 16000 && SLICES_PER_SECOND == 250
 
 const PhonemeFlags phonemeFlags[PHONEME_TYPE_COUNT] PROGMEM = {
 	[PHONEME_TYPE_SILENCE] = {
-		//.glide = false,
-		//.obstruent = false,
+		.glide = 0,
+		.obstruent = 0,
+		.buzz = BUZZ_VOWEL,
 		.presrc = SOURCE_SILENCE,
 		.nsrc = SOURCE_SILENCE,
 		.postsrc = SOURCE_SILENCE,
-		.ndur = D(40), // estimate (somewhat fine-tuned)
-		.tdur = D(0),
-	}, // silent
+		.ndur = 10, // 40 ms
+		.tdur = 0, // 0 ms
+	},
 	[PHONEME_TYPE_PLOSIVE] = {
-		.glide = true,
-		.obstruent = true,
+		.glide = 1,
+		.obstruent = 1,
+		.buzz = BUZZ_VOWEL,
 		.presrc = SOURCE_SILENCE,
 		.nsrc = SOURCE_FRICATION,
 		.postsrc = SOURCE_ASPIRATION,
-		.ndur = D(30), // estimate (somewhat fine-tuned)
-		.tdur = D(30), // estimate (somewhat fine-tuned)
+		.ndur = 7, // 30 ms
+		.tdur = 7, // 30 ms
 	},
 	[PHONEME_TYPE_VPLOSIVE] = {
-		.glide = true,
-		.obstruent = true,
+		.glide = 1,
+		.obstruent = 1,
+		.buzz = BUZZ_PLOSIVE,
 		.presrc = SOURCE_BUZZ,
 		.nsrc = SOURCE_SILENCE,
 		.postsrc = SOURCE_BUZZ,
-		.buzz = BUZZ_PLOSIVE,
-		.ndur = D(30), // estimate (somewhat fine-tuned)
-		.tdur = D(20), // estimate (somewhat fine-tuned)
-	}, // voiced plosive
+		.ndur = 7, // 30 ms
+		.tdur = 5, // 20 ms
+	},
 	[PHONEME_TYPE_FRICATIVE] = {
-		//.glide = false,
-		//.obstruent = false,
+		.glide = 0,
+		.obstruent = 0,
+		.buzz = BUZZ_VOWEL,
 		.presrc = SOURCE_SILENCE,
 		.nsrc = SOURCE_FRICATION,
 		.postsrc = SOURCE_SILENCE,
-		.ndur = D(110), // estimate (somewhat fine-tuned)
-		.tdur = D(0),
+		.ndur = 27, // 110 ms
+		.tdur = 0, // 0 ms
 	},
 	[PHONEME_TYPE_ASPIRATED] = {
-		//.glide = false,
-		//.obstruent = false,
+		.glide = 0,
+		.obstruent = 0,
+		.buzz = BUZZ_VOWEL,
 		.presrc = SOURCE_ASPIRATION,
 		.nsrc = SOURCE_ASPIRATION,
 		.postsrc = SOURCE_ASPIRATION,
-		.ndur = D(0), // estimate
-		.tdur = D(80), // estimate
+		.ndur = 0, // 0 ms
+		.tdur = 20, // 80 ms
 	},
 	[PHONEME_TYPE_VOWEL] = {
-		.glide = true,
-		//.obstruent = false,
+		.glide = 1,
+		.obstruent = 0,
+		.buzz = BUZZ_VOWEL,
 		.presrc = SOURCE_BUZZ,
 		.nsrc = SOURCE_BUZZ,
 		.postsrc = SOURCE_BUZZ,
-		.buzz = BUZZ_VOWEL,
-		.ndur = D(50), // estimate (somewhat fine-tuned)
-		.tdur = D(30), // estimate (somewhat fine-tuned)
+		.ndur = 12, // 50 ms
+		.tdur = 7, // 30 ms
 	},
 	[PHONEME_TYPE_SEMIVOWEL] = {
-		.glide = true,
-		//.obstruent = false,
+		.glide = 1,
+		.obstruent = 0,
+		.buzz = BUZZ_VOWEL,
 		.presrc = SOURCE_BUZZ,
 		.nsrc = SOURCE_BUZZ,
 		.postsrc = SOURCE_BUZZ,
-		.buzz = BUZZ_VOWEL,
-		.ndur = D(30), // guessed
-		.tdur = D(50), // guessed
+		.ndur = 7, // 30 ms
+		.tdur = 12, // 50 ms
 	},
-	[PHONEME_TYPE_LIQUID] = {
-		.glide = true,
-		//.obstruent = false,
+	[PHONEME_TYPE_NASAL] = {
+		.glide = 1,
+		.obstruent = 1,
+		.buzz = BUZZ_NASAL,
 		.presrc = SOURCE_BUZZ,
 		.nsrc = SOURCE_BUZZ,
 		.postsrc = SOURCE_BUZZ,
-		.buzz = BUZZ_LIQUID,
-		.ndur = D(100), // estimate
-		.tdur = D(25), // estimate
+		.ndur = 15, // 60 ms
+		.tdur = 7, // 30 ms
 	},
-	[PHONEME_TYPE_NASAL] = {
-		.glide = true,
-		.obstruent = true,
+	[PHONEME_TYPE_LIQUID] = {
+		.glide = 1,
+		.obstruent = 0,
+		.buzz = BUZZ_LIQUID,
 		.presrc = SOURCE_BUZZ,
 		.nsrc = SOURCE_BUZZ,
 		.postsrc = SOURCE_BUZZ,
-		.buzz = BUZZ_NASAL,
-		.ndur = D(60), // estimate (somewhat fine-tuned)
-		.tdur = D(30), // estimate (somewhat fine-tuned)
+		.ndur = 25, // 100 ms
+		.tdur = 6, // 25 ms
 	},
 };
 
 const Voice voiceBob PROGMEM = {
-	.pitch = F(130), // XXX estimate
-	.rate = 120, // XXX estimate
-	// TODO put buzz waveforms here?
-
-	.phonemes = {
-[P_j] = {
-	.type = PHONEME_TYPE_SEMIVOWEL,
-	.f = { .f = { F(140), F(235), F(2100), F(3000) }, }, // estimated values
-	.obstargets = {
-		[OBS_LABIAL]   = { .f = { F(140), F(180), F( 600),F(3000) }, },
-		[OBS_ALVEOLAR] = { .f = { F(140), F(180), F(1700),F(3000) }, },
-		[OBS_VELAR]    = { .f = { F(140), F(180), F(3500),F(3500) }, },
-		[OBS_VELAR]    = { .f = { F(139), F(180), F(2700),F(3000) }, },
-	},
-},
-[P_i] = {
-	.type = PHONEME_TYPE_VOWEL,
-	.f = { .f = { F(139), F(343), F(2323), F(3000) }, },
-	.obstargets = {
-		[OBS_LABIAL]   = { .f = { F(139), F(180), F( 600),F(3000) }, },
-		[OBS_ALVEOLAR] = { .f = { F(139), F(180), F(1700),F(3000) }, },
-		[OBS_VELAR]    = { .f = { F(139), F(180), F(3500),F(3800) }, },
-		[OBS_VELAR]    = { .f = { F(139), F(180), F(2700),F(3000) }, },
-	},
-},
-[P_I] = {
-	.type = PHONEME_TYPE_VOWEL,
-	.f = { .f = { F(136), F(429), F(2034), F(2687) }, },
-	.obstargets = {
-		[OBS_LABIAL]   = { .f = { F(136), F(180), F( 600),F(2687) }, },
-		[OBS_ALVEOLAR] = { .f = { F(136), F(180), F(1700),F(2687) }, },
-		[OBS_VELAR]    = { .f = { F(136), F(180), F(3500),F(3800) }, },
-		[OBS_VELAR]    = { .f = { F(136), F(180), F(2600),F(2900) }, },
+	.pitch = 532, // 130 Hz
+	.rate = 120,
+	.modulated_pitch = {
+		532, 567, 592, 610, 619, 610, 592, 567,
+		532, 494, 469, 450, 442, 450, 469, 494,
 	},
-},
-[P_e] = {
-	.type = PHONEME_TYPE_VOWEL,
-	// XXX should F2 be lower than F2 of I?
-	.f = { .f = { F(129), F(476), F(2090), F(2692) }, },
-	.obstargets = {
-		[OBS_LABIAL]   = { .f = { F(129), F(180), F( 600),F(2692) }, },
-		[OBS_ALVEOLAR] = { .f = { F(129), F(180), F(1700),F(2692) }, },
-		[OBS_VELAR]    = { .f = { F(129), F(180), F(3500),F(3800) }, },
-		[OBS_VELAR]    = { .f = { F(129), F(180), F(2600),F(2900) }, },
-	},
-},
-
-// i I e E a A O V o U u
-
-[P_E] = {
-	.type = PHONEME_TYPE_VOWEL,
-	.f = { .f = { F(127), F(588), F(1803), F(2604) }, },
-	.obstargets = {
-		[OBS_LABIAL]   = { .f = { F(127), F(180), F( 600),F(2604) }, },
-		[OBS_ALVEOLAR] = { .f = { F(127), F(180), F(1700),F(2604) }, },
-		[OBS_VELAR]    = { .f = { F(127), F(180), F(3500),F(3800) }, },
-		[OBS_VELAR]    = { .f = { F(127), F(180), F(2600),F(2900) }, },
-	},
-},
-[P_ae] = {
-	.type = PHONEME_TYPE_VOWEL,
-	.f = { .f = { F(126), F(591), F(1930), F(2595) }, },
-	.f = { .f = { F(126), F(600), F(2050), F(2595) }, }, // experiments
-	.obstargets = {
-		[OBS_LABIAL]   = { .f = { F(126), F(180), F( 600),F(2595) }, },
-		[OBS_ALVEOLAR] = { .f = { F(126), F(180), F(1700),F(2595) }, },
-		[OBS_VELAR]    = { .f = { F(126), F(180), F(3500),F(3800) }, },
-		[OBS_VELAR]    = { .f = { F(126), F(180), F(2600),F(2900) }, },
-	},
-},
-[P_a] = {
-	.type = PHONEME_TYPE_VOWEL,
-	// XXX should F2 be lower than F2 of E?
-	.f = { .f = { F(128), F(620), F(1900), F(2600) }, }, // estimated values
-	.f = { .f = { F(128), F(700), F(1800), F(2600) }, }, // experiments
-	.obstargets = {
-		[OBS_LABIAL]   = { .f = { F(128), F(50), F( 600), F(2600) }, },
-		[OBS_ALVEOLAR] = { .f = { F(128), F(50), F(1700), F(2600) }, },
-		[OBS_VELAR]    = { .f = { F(128), F(50), F(3500), F(3800) }, },
-		[OBS_VELAR]    = { .f = { F(128), F(50), F(2500), F(2800) }, },
-	},
-},
-
-// F1 peaks here
-[P_A] = {
-	.type = PHONEME_TYPE_VOWEL,
-	.f = { .f = { F(127), F(756), F(1309), F(2535) }, },
-	.obstargets = {
-		[OBS_LABIAL]   = { .f = { F(125),F(180),F( 600),F(2535) }, },
-		[OBS_ALVEOLAR] = { .f = { F(125),F(180),F(1700),F(2535) }, },
-		[OBS_VELAR]    = { .f = { F(125),F(180),F(3500),F(3800) }, },
-		[OBS_VELAR]    = { .f = { F(125),F(180),F(2300),F(2600) }, },
+	.phonemes = {
+		[P_none] = {
+			.type = PHONEME_TYPE_SILENCE,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 0, 0, 0, 0 }, },
+		},
+		[P_j] = {
+			.type = PHONEME_TYPE_SEMIVOWEL,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 573, 962, 8601, 12288 }, },
+			.obstargets[OBS_LABIAL] = { .f = { 573, 737, 2457, 12288 }, },
+			.obstargets[OBS_ALVEOLAR] = { .f = { 573, 737, 6963, 12288 }, },
+			.obstargets[OBS_VELAR] = { .f = { 569, 737, 11059, 12288 }, },
+		},
+		[P_w] = {
+			.type = PHONEME_TYPE_SEMIVOWEL,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 532, 1146, 3244, 8826 }, },
+			.obstargets[OBS_LABIAL] = { .f = { 532, 737, 2457, 9646 }, },
+			.obstargets[OBS_ALVEOLAR] = { .f = { 532, 737, 6963, 9646 }, },
+			.obstargets[OBS_VELAR] = { .f = { 532, 737, 6144, 7372 }, },
+		},
+		[P_i] = {
+			.type = PHONEME_TYPE_VOWEL,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 569, 1404, 9515, 12288 }, },
+			.obstargets[OBS_LABIAL] = { .f = { 569, 737, 2457, 12288 }, },
+			.obstargets[OBS_ALVEOLAR] = { .f = { 569, 737, 6963, 12288 }, },
+			.obstargets[OBS_VELAR] = { .f = { 569, 737, 11059, 12288 }, },
+		},
+		[P_u] = {
+			.type = PHONEME_TYPE_VOWEL,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 532, 1556, 4063, 9646 }, },
+			.obstargets[OBS_LABIAL] = { .f = { 532, 737, 2457, 9646 }, },
+			.obstargets[OBS_ALVEOLAR] = { .f = { 532, 737, 6963, 9646 }, },
+			.obstargets[OBS_VELAR] = { .f = { 532, 737, 6144, 7372 }, },
+		},
+		[P_I] = {
+			.type = PHONEME_TYPE_VOWEL,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 557, 1757, 8331, 11005 }, },
+			.obstargets[OBS_LABIAL] = { .f = { 557, 737, 2457, 11005 }, },
+			.obstargets[OBS_ALVEOLAR] = { .f = { 557, 737, 6963, 11005 }, },
+			.obstargets[OBS_VELAR] = { .f = { 557, 737, 10649, 11878 }, },
+		},
+		[P_U] = {
+			.type = PHONEME_TYPE_VOWEL,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 544, 1921, 4599, 9973 }, },
+			.obstargets[OBS_LABIAL] = { .f = { 544, 737, 2457, 9973 }, },
+			.obstargets[OBS_ALVEOLAR] = { .f = { 544, 737, 6963, 9973 }, },
+			.obstargets[OBS_VELAR] = { .f = { 544, 737, 6144, 7372 }, },
+		},
+		[P_e] = {
+			.type = PHONEME_TYPE_VOWEL,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 528, 1949, 8560, 11026 }, },
+			.obstargets[OBS_LABIAL] = { .f = { 528, 737, 2457, 11026 }, },
+			.obstargets[OBS_ALVEOLAR] = { .f = { 528, 737, 6963, 11026 }, },
+			.obstargets[OBS_VELAR] = { .f = { 528, 737, 10649, 11878 }, },
+		},
+		[P_o] = {
+			.type = PHONEME_TYPE_VOWEL,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 532, 2039, 3727, 10072 }, },
+			.obstargets[OBS_LABIAL] = { .f = { 532, 737, 2457, 10072 }, },
+			.obstargets[OBS_ALVEOLAR] = { .f = { 532, 737, 6963, 10072 }, },
+			.obstargets[OBS_VELAR] = { .f = { 532, 737, 6144, 7372 }, },
+		},
+		[P_V] = {
+			.type = PHONEME_TYPE_VOWEL,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 528, 2543, 4878, 10436 }, },
+			.obstargets[OBS_LABIAL] = { .f = { 528, 737, 2457, 10436 }, },
+			.obstargets[OBS_ALVEOLAR] = { .f = { 528, 737, 6963, 10436 }, },
+			.obstargets[OBS_VELAR] = { .f = { 528, 737, 6144, 7372 }, },
+		},
+		[P_SCHWA] = {
+			.type = PHONEME_TYPE_VOWEL,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 532, 2048, 6144, 10240 }, },
+			.obstargets[OBS_LABIAL] = { .f = { 532, 737, 2457, 10240 }, },
+			.obstargets[OBS_ALVEOLAR] = { .f = { 532, 737, 6963, 10240 }, },
+			.obstargets[OBS_VELAR] = { .f = { 532, 737, 6144, 7372 }, },
+		},
+		[P_R] = {
+			.type = PHONEME_TYPE_VOWEL,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 532, 1228, 6144, 6963 }, },
+			.obstargets[OBS_LABIAL] = { .f = { 532, 737, 2457, 9646 }, },
+			.obstargets[OBS_ALVEOLAR] = { .f = { 532, 737, 6963, 9646 }, },
+			.obstargets[OBS_VELAR] = { .f = { 532, 737, 6144, 6144 }, },
+		},
+		[P_E] = {
+			.type = PHONEME_TYPE_VOWEL,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 520, 2408, 7385, 10665 }, },
+			.obstargets[OBS_LABIAL] = { .f = { 520, 737, 2457, 10665 }, },
+			.obstargets[OBS_ALVEOLAR] = { .f = { 520, 737, 6963, 10665 }, },
+			.obstargets[OBS_VELAR] = { .f = { 520, 737, 10649, 11878 }, },
+		},
+		[P_O] = {
+			.type = PHONEME_TYPE_VOWEL,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 512, 2686, 4190, 10326 }, },
+			.obstargets[OBS_LABIAL] = { .f = { 512, 737, 2457, 10326 }, },
+			.obstargets[OBS_ALVEOLAR] = { .f = { 512, 737, 6963, 10326 }, },
+			.obstargets[OBS_VELAR] = { .f = { 512, 737, 6144, 7372 }, },
+		},
+		[P_ae] = {
+			.type = PHONEME_TYPE_VOWEL,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 516, 2457, 8396, 10629 }, },
+			.obstargets[OBS_LABIAL] = { .f = { 516, 737, 2457, 10629 }, },
+			.obstargets[OBS_ALVEOLAR] = { .f = { 516, 737, 6963, 10629 }, },
+			.obstargets[OBS_VELAR] = { .f = { 516, 737, 10649, 11878 }, },
+		},
+		[P_a] = {
+			.type = PHONEME_TYPE_VOWEL,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 524, 2867, 7372, 10649 }, },
+			.obstargets[OBS_LABIAL] = { .f = { 524, 204, 2457, 10649 }, },
+			.obstargets[OBS_ALVEOLAR] = { .f = { 524, 204, 6963, 10649 }, },
+			.obstargets[OBS_VELAR] = { .f = { 524, 204, 10240, 11468 }, },
+		},
+		[P_A] = {
+			.type = PHONEME_TYPE_VOWEL,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 520, 3096, 5361, 10383 }, },
+			.obstargets[OBS_LABIAL] = { .f = { 512, 737, 2457, 10383 }, },
+			.obstargets[OBS_ALVEOLAR] = { .f = { 512, 737, 6963, 10383 }, },
+			.obstargets[OBS_VELAR] = { .f = { 512, 737, 9420, 10649 }, },
+		},
+		[P_l] = {
+			.type = PHONEME_TYPE_LIQUID,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 532, 1228, 6144, 11468 }, },
+			.obstargets[OBS_LABIAL] = { .f = { 532, 204, 2457, 11468 }, },
+			.obstargets[OBS_ALVEOLAR] = { .f = { 532, 204, 6963, 11468 }, },
+			.obstargets[OBS_VELAR] = { .f = { 532, 204, 8601, 8601 }, },
+		},
+		[P_r] = {
+			.type = PHONEME_TYPE_LIQUID,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 532, 1228, 4505, 7782 }, },
+		},
+		[P_m] = {
+			.type = PHONEME_TYPE_NASAL,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 532, 737, 4096, 8192 }, },
+		},
+		[P_n] = {
+			.type = PHONEME_TYPE_NASAL,
+			.obstype = OBS_ALVEOLAR,
+			.f = { .f = { 532, 737, 6963, 11059 }, },
+		},
+		[P_N] = {
+			.type = PHONEME_TYPE_NASAL,
+			.obstype = OBS_VELAR,
+			.f = { .f = { 532, 737, 9420, 0 }, },
+		},
+		[P_b] = {
+			.type = PHONEME_TYPE_VPLOSIVE,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 409, 1228, 2048, 3686 }, },
+		},
+		[P_p] = {
+			.type = PHONEME_TYPE_PLOSIVE,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 0, 2048, 2048, 2048 }, },
+		},
+		[P_d] = {
+			.type = PHONEME_TYPE_VPLOSIVE,
+			.obstype = OBS_ALVEOLAR,
+			.f = { .f = { 409, 1228, 2048, 3686 }, },
+		},
+		[P_t] = {
+			.type = PHONEME_TYPE_PLOSIVE,
+			.obstype = OBS_ALVEOLAR,
+			.f = { .f = { 0, 16384, 16384, 16384 }, },
+		},
+		[P_g] = {
+			.type = PHONEME_TYPE_VPLOSIVE,
+			.obstype = OBS_VELAR,
+			.f = { .f = { 409, 1228, 2048, 3686 }, },
+		},
+		[P_k] = {
+			.type = PHONEME_TYPE_PLOSIVE,
+			.obstype = OBS_VELAR,
+			.f = { .f = { 0, 4915, 4915, 4915 }, },
+		},
+		[P_f] = {
+			.type = PHONEME_TYPE_FRICATIVE,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 0, 3481, 4915, 0 }, },
+		},
+		[P_v] = {
+			.type = PHONEME_TYPE_FRICATIVE,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 491, 3481, 4915, 0 }, },
+		},
+		[P_s] = {
+			.type = PHONEME_TYPE_FRICATIVE,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 0, 16384, 24576, 28672 }, },
+		},
+		[P_z] = {
+			.type = PHONEME_TYPE_FRICATIVE,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 491, 16384, 24576, 28672 }, },
+		},
+		[P_S] = {
+			.type = PHONEME_TYPE_FRICATIVE,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 0, 10240, 19660, 26214 }, },
+		},
+		[P_Z] = {
+			.type = PHONEME_TYPE_FRICATIVE,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 491, 10240, 19660, 26214 }, },
+		},
+		[P_T] = {
+			.type = PHONEME_TYPE_FRICATIVE,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 0, 22528, 0, 0 }, },
+		},
+		[P_D] = {
+			.type = PHONEME_TYPE_FRICATIVE,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 491, 22528, 0, 0 }, },
+		},
+		[P_h] = {
+			.type = PHONEME_TYPE_ASPIRATED,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 0, 0, 0, 0 }, },
+		},
 	},
-},
+};
 
-// i I e E a A O V o U u
+#elif SAMPLE_RATE == 24000 && SLICES_PER_SECOND == 250
 
-[P_O] = {
-	.type = PHONEME_TYPE_VOWEL,
-	.f = { .f = { F(125), F(656), F(1023), F(2521) }, },
-	.obstargets = {
-		[OBS_LABIAL]   = { .f = { F(125), F(180), F( 600),F(2521) }, },
-		[OBS_ALVEOLAR] = { .f = { F(125), F(180), F(1700),F(2521) }, },
-		[OBS_VELAR]    = { .f = { F(125), F(180), F(1500),F(1800) }, },
-		[OBS_VELAR]    = { .f = { F(125), F(180), F(1500),F(1800) }, },
+const PhonemeFlags phonemeFlags[PHONEME_TYPE_COUNT] PROGMEM = {
+	[PHONEME_TYPE_SILENCE] = {
+		.glide = 0,
+		.obstruent = 0,
+		.buzz = BUZZ_VOWEL,
+		.presrc = SOURCE_SILENCE,
+		.nsrc = SOURCE_SILENCE,
+		.postsrc = SOURCE_SILENCE,
+		.ndur = 10, // 40 ms
+		.tdur = 0, // 0 ms
 	},
-},
-[P_V] = {
-	.type = PHONEME_TYPE_VOWEL,
-	.f = { .f = { F(129), F(621), F(1191), F(2548) }, },
-	.obstargets = {
-		[OBS_LABIAL]   = { .f = { F(129), F(180), F( 600),F(2548) }, },
-		[OBS_ALVEOLAR] = { .f = { F(129), F(180), F(1700),F(2548) }, },
-		[OBS_VELAR]    = { .f = { F(129), F(180), F(1500),F(1800) }, },
+	[PHONEME_TYPE_PLOSIVE] = {
+		.glide = 1,
+		.obstruent = 1,
+		.buzz = BUZZ_VOWEL,
+		.presrc = SOURCE_SILENCE,
+		.nsrc = SOURCE_FRICATION,
+		.postsrc = SOURCE_ASPIRATION,
+		.ndur = 7, // 30 ms
+		.tdur = 7, // 30 ms
 	},
-},
-[P_o] = {
-	.type = PHONEME_TYPE_VOWEL,
-	.f = { .f = { F(130), F(498), F(910), F(2459) }, },
-	.obstargets = {
-		[OBS_LABIAL]   = { .f = { F(130), F(180), F( 600),F(2459) }, },
-		[OBS_ALVEOLAR] = { .f = { F(130), F(180), F(1700),F(2459) }, },
-		[OBS_VELAR]    = { .f = { F(130), F(180), F(1500),F(1800) }, },
+	[PHONEME_TYPE_VPLOSIVE] = {
+		.glide = 1,
+		.obstruent = 1,
+		.buzz = BUZZ_PLOSIVE,
+		.presrc = SOURCE_BUZZ,
+		.nsrc = SOURCE_SILENCE,
+		.postsrc = SOURCE_BUZZ,
+		.ndur = 7, // 30 ms
+		.tdur = 5, // 20 ms
 	},
-},
-[P_U] = {
-	.type = PHONEME_TYPE_VOWEL,
-	.f = { .f = { F(133), F(469), F(1123), F(2435) }, },
-	.obstargets = {
-		[OBS_LABIAL]   = { .f = { F(133), F(180), F( 600),F(2435) }, },
-		[OBS_ALVEOLAR] = { .f = { F(133), F(180), F(1700),F(2435) }, },
-		[OBS_VELAR]    = { .f = { F(133), F(180), F(1500),F(1800) }, },
+	[PHONEME_TYPE_FRICATIVE] = {
+		.glide = 0,
+		.obstruent = 0,
+		.buzz = BUZZ_VOWEL,
+		.presrc = SOURCE_SILENCE,
+		.nsrc = SOURCE_FRICATION,
+		.postsrc = SOURCE_SILENCE,
+		.ndur = 27, // 110 ms
+		.tdur = 0, // 0 ms
 	},
-},
-
-// i I e E a A O V o U u
-
-[P_u] = {
-	.type = PHONEME_TYPE_VOWEL,
-	.f = { .f = { F(130), F(380), F(992), F(2355) }, },
-	.obstargets = {
-		[OBS_LABIAL]   = { .f = { F(130), F(180), F( 600),F(2355) }, },
-		[OBS_ALVEOLAR] = { .f = { F(130), F(180), F(1700),F(2355) }, },
-		[OBS_VELAR]    = { .f = { F(130), F(180), F(1500),F(1800) }, },
+	[PHONEME_TYPE_ASPIRATED] = {
+		.glide = 0,
+		.obstruent = 0,
+		.buzz = BUZZ_VOWEL,
+		.presrc = SOURCE_ASPIRATION,
+		.nsrc = SOURCE_ASPIRATION,
+		.postsrc = SOURCE_ASPIRATION,
+		.ndur = 0, // 0 ms
+		.tdur = 20, // 80 ms
 	},
-},
-
-// /w/ is like /u/ but shorter in duration
-[P_w] = {
-	.type = PHONEME_TYPE_SEMIVOWEL,
-	.f = { .f = { F(130), F(380), F(992), F(2355) }, }, // not actual values
-	.f = { .f = { F(130), F(280), F(792), F(2155) }, }, // estimated
-	.obstargets = {
-		[OBS_LABIAL]   = { .f = { F(130), F(180), F( 600),F(2355) }, },
-		[OBS_ALVEOLAR] = { .f = { F(130), F(180), F(1700),F(2355) }, },
-		[OBS_VELAR]    = { .f = { F(130), F(180), F(1500),F(1800) }, },
+	[PHONEME_TYPE_VOWEL] = {
+		.glide = 1,
+		.obstruent = 0,
+		.buzz = BUZZ_VOWEL,
+		.presrc = SOURCE_BUZZ,
+		.nsrc = SOURCE_BUZZ,
+		.postsrc = SOURCE_BUZZ,
+		.ndur = 12, // 50 ms
+		.tdur = 7, // 30 ms
 	},
-},
-[P_SCHWA] = {
-	.type = PHONEME_TYPE_VOWEL,
-	.f = { .f = { F(130), F(500), F(1500), F(2500) }, }, // not actual values
-	.obstargets = {
-		[OBS_LABIAL]   = { .f = { F(130), F(180), F( 600),F(2500) }, },
-		[OBS_ALVEOLAR] = { .f = { F(130), F(180), F(1700),F(2500) }, },
-		[OBS_VELAR]    = { .f = { F(130), F(180), F(1500),F(1800) }, },
+	[PHONEME_TYPE_SEMIVOWEL] = {
+		.glide = 1,
+		.obstruent = 0,
+		.buzz = BUZZ_VOWEL,
+		.presrc = SOURCE_BUZZ,
+		.nsrc = SOURCE_BUZZ,
+		.postsrc = SOURCE_BUZZ,
+		.ndur = 7, // 30 ms
+		.tdur = 12, // 50 ms
 	},
-},
-[P_R] = {
-	.type = PHONEME_TYPE_VOWEL,
-	.f = { .f = { F(130), F(300), F(1500), F(1700) }, }, // not actual values
-	.obstargets = {
-		[OBS_LABIAL]   = { .f = { F(130), F(180), F( 600),F(2355) }, },
-		[OBS_ALVEOLAR] = { .f = { F(130), F(180), F(1700),F(2355) }, },
-		[OBS_VELAR]    = { .f = { F(130), F(180), F(1500),F(1500) }, },
+	[PHONEME_TYPE_NASAL] = {
+		.glide = 1,
+		.obstruent = 1,
+		.buzz = BUZZ_NASAL,
+		.presrc = SOURCE_BUZZ,
+		.nsrc = SOURCE_BUZZ,
+		.postsrc = SOURCE_BUZZ,
+		.ndur = 15, // 60 ms
+		.tdur = 7, // 30 ms
 	},
-},
-[P_r] = {
-	.type = PHONEME_TYPE_LIQUID,
-	.f = { .f = { F(130), F(300), F(1100), F(1900) }, }, // not actual values
-}, // how is this different from p_R?
-
-// liquids (treated like vowels)
-[P_l] = {
-	.type = PHONEME_TYPE_LIQUID,
-	.f = { .f = { F(130), F(300), F(1500), F(2800) }, }, // estimated values
-	.obstargets = {
-		[OBS_LABIAL]   = { .f = { F(130), F(50), F( 600), F(2800) }, },
-		[OBS_ALVEOLAR] = { .f = { F(130), F(50), F(1700), F(2800) }, },
-		[OBS_VELAR]    = { .f = { F(130), F(50), F(3500), F(3500) }, },
-		[OBS_VELAR]    = { .f = { F(130), F(50), F(2100), F(2100) }, },
+	[PHONEME_TYPE_LIQUID] = {
+		.glide = 1,
+		.obstruent = 0,
+		.buzz = BUZZ_LIQUID,
+		.presrc = SOURCE_BUZZ,
+		.nsrc = SOURCE_BUZZ,
+		.postsrc = SOURCE_BUZZ,
+		.ndur = 25, // 100 ms
+		.tdur = 6, // 25 ms
 	},
-},
-
-/*
-Nasal    F2
-/m/    1000
-/n/    2000
-/N/    3000
-
-Nasal frequencies:
-Nasal   F1    F2    F3
-/m/    250  1000  2000
-/n/    250  2000  2700
-/N/    250  2300  ???? (what is F3?)
-*/
+};
 
-// nasals
-[P_m] = {
-	.type = PHONEME_TYPE_NASAL,
-	.f = { .f = { F(130), F(180), F(1000), F(2000) }, },
-	.obstype = OBS_LABIAL,
-	/*
-	.target = {
-		130), F(180), F(1000), F(2000
-	},
-	*/
-},
-[P_n] = {
-	.type = PHONEME_TYPE_NASAL,
-	.f = { .f = { F(130), F(180), F(1700), F(2700) }, },
-	.obstype = OBS_ALVEOLAR,
-	/*
-	.target = {
-		130), F(180), F(1700), F(2700
-	},
-	*/
-},
-[P_N] = {
-	.type = PHONEME_TYPE_NASAL,
-	.f = { .f = { F(130), F(180), F(2300), F(0) }, },
-	.obstype = OBS_VELAR,
-	/*
-	.target = {
-		130), F(180), F(3000), F(0
+const Voice voiceBob PROGMEM = {
+	.pitch = 354, // 130 Hz
+	.rate = 120,
+	.modulated_pitch = {
+		354, 377, 394, 406, 412, 406, 394, 377,
+		354, 329, 312, 300, 294, 300, 312, 329,
 	},
-	*/
-},
-
-// plosives
-// TODO re-read the pi-ka-pu experiment and other papers on the subject to
-// derive suitable plosive frication frequencies
-// XXX are these frequencies used for the frication?
-[P_b] = {
-	.type = PHONEME_TYPE_VPLOSIVE,
-	.f = { .f = { F(100), F(300), F(500), F(900) }, }, // not actual values
-	.obstype = OBS_LABIAL,
-},
-[P_d] = {
-	.type = PHONEME_TYPE_VPLOSIVE,
-	.f = { .f = { F(100), F(300), F(500), F(900) }, }, // not actual values
-	.obstype = OBS_ALVEOLAR,
-},
-[P_g] = {
-	.type = PHONEME_TYPE_VPLOSIVE,
-	.f = { .f = { F(100), F(300), F(500), F(900) }, }, // not actual values
-	.obstype = OBS_VELAR,
-},
-[P_p] = {
-	.type = PHONEME_TYPE_PLOSIVE,
-	.f = { .f = { F(100), F(300), F(500), F(900) }, }, // not actual values
-	.f = { .f = {   F(0), F(500), F(500), F(500) }, }, // estimates based on pi-ka-pu
-	.obstype = OBS_LABIAL,
-},
-[P_t] = {
-	.type = PHONEME_TYPE_PLOSIVE,
-	.f = { .f = { F(100),  F(300),  F(500),  F(900) }, }, // not actual values
-	.f = { .f = {   F(0), F(4000), F(4000), F(4000) }, }, // estimates based on pi-ka-pu
-	.obstype = OBS_ALVEOLAR,
-},
-[P_k] = {
-	.type = PHONEME_TYPE_PLOSIVE,
-	.f = { .f = { F(100),  F(300),  F(500),  F(900) }, }, // not actual values
-	.f = { .f = {   F(0), F(1200), F(1200), F(1200) }, }, // estimates based on pi-ka-pu
-	.obstype = OBS_VELAR,
-},
-
-// fricatives
-[P_f] = {
-	.type = PHONEME_TYPE_FRICATIVE,
-	.f = { .f = { F(0), F(100),  F(100), F(100) }, }, // estimates
-	.f = { .f = { F(0), F(850), F(1200),   F(0) }, }, // estimates (somewhat fine-tuned)
-},
-[P_v] = {
-	.type = PHONEME_TYPE_FRICATIVE,
-	.f = { .f = { F(120),   F(0), F(1050), F(100) }, }, // estimates
-	.f = { .f = { F(120), F(850), F(1200),   F(0) }, }, // estimates (somewhat fine-tuned)
-},
-[P_s] = {
-	.type = PHONEME_TYPE_FRICATIVE,
-	.f = { .f = { F(0), F(4000), F(6000), F(7000) }, },
-
-},
-[P_z] = {
-	.type = PHONEME_TYPE_FRICATIVE,
-	.f = { .f = { F(120), F(4000), F(6000), F(7000) }, },
-},
-[P_S] = {
-	.type = PHONEME_TYPE_FRICATIVE,
-	.f = { .f = { F(0), F(2500), F(4800), F(6400) }, },
-},
-[P_Z] = {
-	.type = PHONEME_TYPE_FRICATIVE,
-	.f = { .f = { F(120), F(2500), F(4800), F(6400) }, },
-},
-[P_T] = {
-	.type = PHONEME_TYPE_FRICATIVE,
-	.f = { .f = { F(0), F(5500), F(0), F(0) }, }, // estimate
-},
-[P_D] = {
-	.type = PHONEME_TYPE_FRICATIVE,
-	.f = { .f = { F(120), F(5500), F(0), F(0) }, }, // estimate
-},
-
-[P_none] = {
-	.type = PHONEME_TYPE_SILENCE,
-},
-
-// aspirated
-[P_h] = {
-	.type = PHONEME_TYPE_ASPIRATED,
-},
-
-//		[P_none] = &p_none,
-//		[P_j] = &p_j,
-//		[P_w] = &p_w,
-//		[P_i] = &p_i,
-//		[P_u] = &p_u,
-//		[P_I] = &p_I,
-//		[P_U] = &p_U,
-//		[P_e] = &p_e,
-//		[P_o] = &p_o,
-//		[P_V] = &p_V,
-//		[P_SCHWA] = &p_SCHWA,
-//		[P_R] = &p_R,
-//		[P_E] = &p_E,
-//		[P_O] = &p_O,
-//		[P_ae] = &p_ae,
-//		[P_a] = &p_a,
-//		[P_A] = &p_A,
-//
-//		// liquids
-//		[P_l] = &p_l,
-//		[P_r] = &p_r, // how is this different from P_R?
-//
-//		// nasals
-//		[P_m] = &p_m,
-//		[P_n] = &p_n,
-//		[P_N] = &p_N,
-//
-//		// stops
-//		[P_b] = &p_b,
-//		[P_p] = &p_p,
-//		[P_d] = &p_d,
-//		[P_t] = &p_t,
-//		[P_g] = &p_g,
-//		[P_k] = &p_k,
-//
-//		// fricatives
-//		[P_f] = &p_f,
-//		[P_v] = &p_v,
-//		[P_s] = &p_s,
-//		[P_z] = &p_z,
-//		[P_S] = &p_S,
-//		[P_Z] = &p_Z,
-//		[P_T] = &p_T,
-//		[P_D] = &p_D,
-//
-//		// aspirated
-//		[P_h] = &p_h,
+	.phonemes = {
+		[P_none] = {
+			.type = PHONEME_TYPE_SILENCE,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 0, 0, 0, 0 }, },
+		},
+		[P_j] = {
+			.type = PHONEME_TYPE_SEMIVOWEL,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 382, 641, 5734, 8192 }, },
+			.obstargets[OBS_LABIAL] = { .f = { 382, 491, 1638, 8192 }, },
+			.obstargets[OBS_ALVEOLAR] = { .f = { 382, 491, 4642, 8192 }, },
+			.obstargets[OBS_VELAR] = { .f = { 379, 491, 7372, 8192 }, },
+		},
+		[P_w] = {
+			.type = PHONEME_TYPE_SEMIVOWEL,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 354, 764, 2162, 5884 }, },
+			.obstargets[OBS_LABIAL] = { .f = { 354, 491, 1638, 6430 }, },
+			.obstargets[OBS_ALVEOLAR] = { .f = { 354, 491, 4642, 6430 }, },
+			.obstargets[OBS_VELAR] = { .f = { 354, 491, 4096, 4915 }, },
+		},
+		[P_i] = {
+			.type = PHONEME_TYPE_VOWEL,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 379, 936, 6343, 8192 }, },
+			.obstargets[OBS_LABIAL] = { .f = { 379, 491, 1638, 8192 }, },
+			.obstargets[OBS_ALVEOLAR] = { .f = { 379, 491, 4642, 8192 }, },
+			.obstargets[OBS_VELAR] = { .f = { 379, 491, 7372, 8192 }, },
+		},
+		[P_u] = {
+			.type = PHONEME_TYPE_VOWEL,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 354, 1037, 2708, 6430 }, },
+			.obstargets[OBS_LABIAL] = { .f = { 354, 491, 1638, 6430 }, },
+			.obstargets[OBS_ALVEOLAR] = { .f = { 354, 491, 4642, 6430 }, },
+			.obstargets[OBS_VELAR] = { .f = { 354, 491, 4096, 4915 }, },
+		},
+		[P_I] = {
+			.type = PHONEME_TYPE_VOWEL,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 371, 1171, 5554, 7337 }, },
+			.obstargets[OBS_LABIAL] = { .f = { 371, 491, 1638, 7337 }, },
+			.obstargets[OBS_ALVEOLAR] = { .f = { 371, 491, 4642, 7337 }, },
+			.obstargets[OBS_VELAR] = { .f = { 371, 491, 7099, 7918 }, },
+		},
+		[P_U] = {
+			.type = PHONEME_TYPE_VOWEL,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 363, 1280, 3066, 6649 }, },
+			.obstargets[OBS_LABIAL] = { .f = { 363, 491, 1638, 6649 }, },
+			.obstargets[OBS_ALVEOLAR] = { .f = { 363, 491, 4642, 6649 }, },
+			.obstargets[OBS_VELAR] = { .f = { 363, 491, 4096, 4915 }, },
+		},
+		[P_e] = {
+			.type = PHONEME_TYPE_VOWEL,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 352, 1299, 5707, 7350 }, },
+			.obstargets[OBS_LABIAL] = { .f = { 352, 491, 1638, 7350 }, },
+			.obstargets[OBS_ALVEOLAR] = { .f = { 352, 491, 4642, 7350 }, },
+			.obstargets[OBS_VELAR] = { .f = { 352, 491, 7099, 7918 }, },
+		},
+		[P_o] = {
+			.type = PHONEME_TYPE_VOWEL,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 354, 1359, 2484, 6714 }, },
+			.obstargets[OBS_LABIAL] = { .f = { 354, 491, 1638, 6714 }, },
+			.obstargets[OBS_ALVEOLAR] = { .f = { 354, 491, 4642, 6714 }, },
+			.obstargets[OBS_VELAR] = { .f = { 354, 491, 4096, 4915 }, },
+		},
+		[P_V] = {
+			.type = PHONEME_TYPE_VOWEL,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 352, 1695, 3252, 6957 }, },
+			.obstargets[OBS_LABIAL] = { .f = { 352, 491, 1638, 6957 }, },
+			.obstargets[OBS_ALVEOLAR] = { .f = { 352, 491, 4642, 6957 }, },
+			.obstargets[OBS_VELAR] = { .f = { 352, 491, 4096, 4915 }, },
+		},
+		[P_SCHWA] = {
+			.type = PHONEME_TYPE_VOWEL,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 354, 1365, 4096, 6826 }, },
+			.obstargets[OBS_LABIAL] = { .f = { 354, 491, 1638, 6826 }, },
+			.obstargets[OBS_ALVEOLAR] = { .f = { 354, 491, 4642, 6826 }, },
+			.obstargets[OBS_VELAR] = { .f = { 354, 491, 4096, 4915 }, },
+		},
+		[P_R] = {
+			.type = PHONEME_TYPE_VOWEL,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 354, 819, 4096, 4642 }, },
+			.obstargets[OBS_LABIAL] = { .f = { 354, 491, 1638, 6430 }, },
+			.obstargets[OBS_ALVEOLAR] = { .f = { 354, 491, 4642, 6430 }, },
+			.obstargets[OBS_VELAR] = { .f = { 354, 491, 4096, 4096 }, },
+		},
+		[P_E] = {
+			.type = PHONEME_TYPE_VOWEL,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 346, 1605, 4923, 7110 }, },
+			.obstargets[OBS_LABIAL] = { .f = { 346, 491, 1638, 7110 }, },
+			.obstargets[OBS_ALVEOLAR] = { .f = { 346, 491, 4642, 7110 }, },
+			.obstargets[OBS_VELAR] = { .f = { 346, 491, 7099, 7918 }, },
+		},
+		[P_O] = {
+			.type = PHONEME_TYPE_VOWEL,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 341, 1791, 2793, 6884 }, },
+			.obstargets[OBS_LABIAL] = { .f = { 341, 491, 1638, 6884 }, },
+			.obstargets[OBS_ALVEOLAR] = { .f = { 341, 491, 4642, 6884 }, },
+			.obstargets[OBS_VELAR] = { .f = { 341, 491, 4096, 4915 }, },
+		},
+		[P_ae] = {
+			.type = PHONEME_TYPE_VOWEL,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 344, 1638, 5597, 7086 }, },
+			.obstargets[OBS_LABIAL] = { .f = { 344, 491, 1638, 7086 }, },
+			.obstargets[OBS_ALVEOLAR] = { .f = { 344, 491, 4642, 7086 }, },
+			.obstargets[OBS_VELAR] = { .f = { 344, 491, 7099, 7918 }, },
+		},
+		[P_a] = {
+			.type = PHONEME_TYPE_VOWEL,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 349, 1911, 4915, 7099 }, },
+			.obstargets[OBS_LABIAL] = { .f = { 349, 136, 1638, 7099 }, },
+			.obstargets[OBS_ALVEOLAR] = { .f = { 349, 136, 4642, 7099 }, },
+			.obstargets[OBS_VELAR] = { .f = { 349, 136, 6826, 7645 }, },
+		},
+		[P_A] = {
+			.type = PHONEME_TYPE_VOWEL,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 346, 2064, 3574, 6922 }, },
+			.obstargets[OBS_LABIAL] = { .f = { 341, 491, 1638, 6922 }, },
+			.obstargets[OBS_ALVEOLAR] = { .f = { 341, 491, 4642, 6922 }, },
+			.obstargets[OBS_VELAR] = { .f = { 341, 491, 6280, 7099 }, },
+		},
+		[P_l] = {
+			.type = PHONEME_TYPE_LIQUID,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 354, 819, 4096, 7645 }, },
+			.obstargets[OBS_LABIAL] = { .f = { 354, 136, 1638, 7645 }, },
+			.obstargets[OBS_ALVEOLAR] = { .f = { 354, 136, 4642, 7645 }, },
+			.obstargets[OBS_VELAR] = { .f = { 354, 136, 5734, 5734 }, },
+		},
+		[P_r] = {
+			.type = PHONEME_TYPE_LIQUID,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 354, 819, 3003, 5188 }, },
+		},
+		[P_m] = {
+			.type = PHONEME_TYPE_NASAL,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 354, 491, 2730, 5461 }, },
+		},
+		[P_n] = {
+			.type = PHONEME_TYPE_NASAL,
+			.obstype = OBS_ALVEOLAR,
+			.f = { .f = { 354, 491, 4642, 7372 }, },
+		},
+		[P_N] = {
+			.type = PHONEME_TYPE_NASAL,
+			.obstype = OBS_VELAR,
+			.f = { .f = { 354, 491, 6280, 0 }, },
+		},
+		[P_b] = {
+			.type = PHONEME_TYPE_VPLOSIVE,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 273, 819, 1365, 2457 }, },
+		},
+		[P_p] = {
+			.type = PHONEME_TYPE_PLOSIVE,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 0, 1365, 1365, 1365 }, },
+		},
+		[P_d] = {
+			.type = PHONEME_TYPE_VPLOSIVE,
+			.obstype = OBS_ALVEOLAR,
+			.f = { .f = { 273, 819, 1365, 2457 }, },
+		},
+		[P_t] = {
+			.type = PHONEME_TYPE_PLOSIVE,
+			.obstype = OBS_ALVEOLAR,
+			.f = { .f = { 0, 10922, 10922, 10922 }, },
+		},
+		[P_g] = {
+			.type = PHONEME_TYPE_VPLOSIVE,
+			.obstype = OBS_VELAR,
+			.f = { .f = { 273, 819, 1365, 2457 }, },
+		},
+		[P_k] = {
+			.type = PHONEME_TYPE_PLOSIVE,
+			.obstype = OBS_VELAR,
+			.f = { .f = { 0, 3276, 3276, 3276 }, },
+		},
+		[P_f] = {
+			.type = PHONEME_TYPE_FRICATIVE,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 0, 2321, 3276, 0 }, },
+		},
+		[P_v] = {
+			.type = PHONEME_TYPE_FRICATIVE,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 327, 2321, 3276, 0 }, },
+		},
+		[P_s] = {
+			.type = PHONEME_TYPE_FRICATIVE,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 0, 10922, 16384, 19114 }, },
+		},
+		[P_z] = {
+			.type = PHONEME_TYPE_FRICATIVE,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 327, 10922, 16384, 19114 }, },
+		},
+		[P_S] = {
+			.type = PHONEME_TYPE_FRICATIVE,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 0, 6826, 13107, 17476 }, },
+		},
+		[P_Z] = {
+			.type = PHONEME_TYPE_FRICATIVE,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 327, 6826, 13107, 17476 }, },
+		},
+		[P_T] = {
+			.type = PHONEME_TYPE_FRICATIVE,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 0, 15018, 0, 0 }, },
+		},
+		[P_D] = {
+			.type = PHONEME_TYPE_FRICATIVE,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 327, 15018, 0, 0 }, },
+		},
+		[P_h] = {
+			.type = PHONEME_TYPE_ASPIRATED,
+			.obstype = OBS_LABIAL,
+			.f = { .f = { 0, 0, 0, 0 }, },
+		},
 	},
 };
-/*
- * F2:
- * bi be ba bo bu: ~600 ?
- * di de da do du: ~1800
- * gi ge ga: ~3500 ?
- * go gu: ~1500 ?
- */
-
-// i I e E a A O V o U u
-
-
 
+#else
+#error no tables for this SAMPLE_RATE and SLICES_PER_SECOND (add them with voicec)
+#endif
@@ -4,5 +4,7 @@
 #include "voice.h"
 
 extern const Voice voiceBob;
+// voiceBob packed by build-voice (bobpacked.c)
+extern const struct packed_voice packedBob;
 
 #endif
@@ -0,0 +1,220 @@
+/* THIS FILE IS AUTO-GENERATED! DO NOT EDIT THIS FILE. */
+
+#include "juno.h"
+#include "packed.h"
+
+#if SAMPLE_RATE == 16000 && SLICES_PER_SECOND == 250
+
+const PackedVoice packedBob PROGMEM = {
+	.pitch = 532,
+	.rate = 120,
+	.flags = {
+		[0] = { 0x00, 0x00, 10, 0 },
+		[1] = { 0x03, 0x18, 7, 7 },
+		[2] = { 0x0b, 0x33, 7, 5 },
+		[3] = { 0x00, 0x08, 27, 0 },
+		[4] = { 0x00, 0x15, 0, 20 },
+		[5] = { 0x01, 0x3f, 12, 7 },
+		[6] = { 0x01, 0x3f, 7, 12 },
+		[7] = { 0x0f, 0x3f, 15, 7 },
+		[8] = { 0x05, 0x3f, 25, 6 },
+	},
+	.type = {
+		0, 134, 134, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+		133, 133, 133, 133, 133, 136, 136, 135, 151, 167, 130, 1,
+		146, 17, 162, 33, 3, 131, 3, 131, 3, 131, 3, 131,
+		4,
+	},
+	.f = {
+		[0] = {
+			0, 92, 100, 108, 113, 119, 124, 125, 128, 136, 128, 102,
+			134, 138, 134, 141, 144, 102, 102, 78, 78, 78, 102, 128,
+			102, 224, 102, 166, 150, 150, 224, 224, 200, 200, 236, 236,
+			0,
+		},
+		[1] = {
+			0, 194, 147, 197, 159, 193, 164, 193, 154, 166, 176, 176,
+			186, 161, 193, 186, 170, 176, 163, 160, 182, 197, 128, 128,
+			128, 224, 128, 166, 166, 166, 240, 240, 230, 230, 0, 0,
+			0,
+		},
+		[2] = {
+			0, 208, 194, 208, 198, 203, 199, 203, 199, 201, 200, 182,
+			202, 200, 202, 202, 201, 205, 189, 192, 203, 0, 154, 128,
+			154, 224, 154, 166, 0, 0, 248, 248, 243, 243, 0, 0,
+			0,
+		},
+	},
+	.obstargets = {
+		[0] = {
+			[0] = {
+				0, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+				78, 78, 78, 19, 78, 19, 0, 0, 0, 0, 0, 0,
+				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+				0,
+			},
+			[1] = {
+				0, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134,
+				134, 134, 134, 134, 134, 134, 0, 0, 0, 0, 0, 0,
+				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+				0,
+			},
+			[2] = {
+				0, 208, 198, 208, 198, 203, 199, 203, 199, 201, 200, 198,
+				202, 200, 202, 202, 201, 205, 0, 0, 0, 0, 0, 0,
+				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+				0,
+			},
+		},
+		[1] = {
+			[0] = {
+				0, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+				78, 78, 78, 19, 78, 19, 0, 0, 0, 0, 0, 0,
+				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+				0,
+			},
+			[1] = {
+				0, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182,
+				182, 182, 182, 182, 182, 182, 0, 0, 0, 0, 0, 0,
+				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+				0,
+			},
+			[2] = {
+				0, 208, 198, 208, 198, 203, 199, 203, 199, 201, 200, 198,
+				202, 200, 202, 202, 201, 205, 0, 0, 0, 0, 0, 0,
+				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+				0,
+			},
+		},
+		[2] = {
+			[0] = {
+				0, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+				78, 78, 78, 19, 78, 19, 0, 0, 0, 0, 0, 0,
+				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+				0,
+			},
+			[1] = {
+				0, 203, 176, 203, 176, 202, 176, 202, 176, 176, 176, 176,
+				202, 176, 202, 200, 197, 194, 0, 0, 0, 0, 0, 0,
+				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+				0,
+			},
+			[2] = {
+				0, 208, 186, 208, 186, 206, 186, 206, 186, 186, 186, 176,
+				206, 186, 206, 205, 202, 194, 0, 0, 0, 0, 0, 0,
+				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+				0,
+			},
+		},
+	},
+};
+
+#elif SAMPLE_RATE == 24000 && SLICES_PER_SECOND == 250
+
+const PackedVoice packedBob PROGMEM = {
+	.pitch = 354,
+	.rate = 120,
+	.flags = {
+		[0] = { 0x00, 0x00, 10, 0 },
+		[1] = { 0x03, 0x18, 7, 7 },
+		[2] = { 0x0b, 0x33, 7, 5 },
+		[3] = { 0x00, 0x08, 27, 0 },
+		[4] = { 0x00, 0x15, 0, 20 },
+		[5] = { 0x01, 0x3f, 12, 7 },
+		[6] = { 0x01, 0x3f, 7, 12 },
+		[7] = { 0x0f, 0x3f, 15, 7 },
+		[8] = { 0x05, 0x3f, 25, 6 },
+	},
+	.type = {
+		0, 134, 134, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+		133, 133, 133, 133, 133, 136, 136, 135, 151, 167, 130, 1,
+		146, 17, 162, 33, 3, 131, 3, 131, 3, 131, 3, 131,
+		4,
+	},
+	.f = {
+		[0] = {
+			0, 72, 80, 90, 96, 101, 104, 105, 106, 117, 107, 83,
+			114, 120, 115, 124, 128, 83, 83, 61, 61, 61, 83, 107,
+			83, 203, 83, 147, 132, 132, 203, 203, 181, 181, 219, 219,
+			0,
+		},
+		[1] = {
+			0, 173, 130, 178, 138, 171, 144, 173, 135, 147, 160, 160,
+			166, 140, 172, 166, 152, 160, 143, 139, 164, 177, 107, 107,
+			107, 203, 107, 147, 147, 147, 224, 224, 211, 211, 0, 0,
+			0,
+		},
+		[2] = {
+			0, 192, 174, 192, 178, 185, 180, 185, 180, 182, 181, 164,
+			184, 182, 183, 183, 182, 188, 169, 171, 186, 0, 134, 107,
+			134, 203, 134, 147, 0, 0, 229, 229, 226, 226, 0, 0,
+			0,
+		},
+	},
+	.obstargets = {
+		[0] = {
+			[0] = {
+				0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+				61, 61, 61, 2, 61, 2, 0, 0, 0, 0, 0, 0,
+				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+				0,
+			},
+			[1] = {
+				0, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115,
+				115, 115, 115, 115, 115, 115, 0, 0, 0, 0, 0, 0,
+				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+				0,
+			},
+			[2] = {
+				0, 192, 178, 192, 178, 185, 180, 185, 180, 182, 181, 178,
+				184, 182, 183, 183, 182, 188, 0, 0, 0, 0, 0, 0,
+				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+				0,
+			},
+		},
+		[1] = {
+			[0] = {
+				0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+				61, 61, 61, 2, 61, 2, 0, 0, 0, 0, 0, 0,
+				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+				0,
+			},
+			[1] = {
+				0, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164,
+				164, 164, 164, 164, 164, 164, 0, 0, 0, 0, 0, 0,
+				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+				0,
+			},
+			[2] = {
+				0, 192, 178, 192, 178, 185, 180, 185, 180, 182, 181, 178,
+				184, 182, 183, 183, 182, 188, 0, 0, 0, 0, 0, 0,
+				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+				0,
+			},
+		},
+		[2] = {
+			[0] = {
+				0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+				61, 61, 61, 2, 61, 2, 0, 0, 0, 0, 0, 0,
+				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+				0,
+			},
+			[1] = {
+				0, 186, 160, 186, 160, 183, 160, 183, 160, 160, 160, 160,
+				183, 160, 183, 181, 177, 173, 0, 0, 0, 0, 0, 0,
+				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+				0,
+			},
+			[2] = {
+				0, 192, 166, 192, 166, 190, 166, 190, 166, 166, 166, 160,
+				190, 166, 190, 188, 183, 173, 0, 0, 0, 0, 0, 0,
+				0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+				0,
+			},
+		},
+	},
+};
+
+#else
+#error no packed voice for this SAMPLE_RATE and SLICES_PER_SECOND (add it to PACKED_RATES)
+#endif
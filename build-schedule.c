@@ -0,0 +1,146 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// generate the precompiled diphone schedules (this runs only on a "big"
+// target)
+//
+// Every pair of phonemes of the voice is planned with diphone_plan, and the
+// segments are written out as the tables declared in diphone.h. This must be
+// built with DIPHONE_TABLE=0 so that diphone.c does not refer to the tables
+// it is generating.
+
+#include "juno.h"
+#include "diphone.h"
+#include "bob.h"
+
+#if DIPHONE_TABLE
+#error build-schedule must be built with -DDIPHONE_TABLE=0
+#endif
+
+// the voice to build the tables for, and its name in C
+#define VOICE voiceBob
+#define STR(x) #x
+#define XSTR(x) STR(x)
+
+// distinct frequency sets, in order of first use
+#define MAX_FREQS (3 * 2 * N_PHONEME * N_PHONEME)
+static FreqSet freqs[MAX_FREQS];
+static int nfreqs;
+
+static int freqs_index(const FreqSet *f)
+{
+	int i;
+	for (i = 0; i < nfreqs; ++i) {
+		if (memcmp(&freqs[i], f, sizeof *f) == 0)
+			return i;
+	}
+	freqs[nfreqs] = *f;
+	return nfreqs++;
+}
+
+// a segment that is not played (nslices 0) is all zeros in the table
+static struct diphone_table_segment table_segment(const struct juno_segment *seg)
+{
+	struct diphone_table_segment t = { 0 };
+	if (seg->nslices == 0)
+		return t;
+	if (seg->nslices < 0 || seg->nslices > 255) {
+		fprintf(stderr, "segment of %d slices does not fit the table\n",
+		        seg->nslices);
+		exit(1);
+	}
+	t.start = freqs_index(&seg->start);
+	t.end = freqs_index(&seg->end);
+	t.nslices = seg->nslices;
+	t.source = seg->source;
+	return t;
+}
+
+static void print_segment(const struct diphone_table_segment *t)
+{
+	printf("{ %u, %u, %u, %u }", t->start, t->end, t->nslices, t->source);
+}
+
+static struct diphone_table_segment nuclei[N_PHONEME];
+static struct diphone_table_transition transitions[N_PHONEME][N_PHONEME];
+
+int main()
+{
+	const Phoneme *phonemes = VOICE.phonemes;
+	int p1, p2, i;
+
+	for (p1 = 0; p1 < N_PHONEME; ++p1) {
+		for (p2 = 0; p2 < N_PHONEME; ++p2) {
+			struct juno_segment segs[DIPHONE_SEGMENTS];
+			diphone_plan(&phonemes[p1], &phonemes[p2], segs);
+			struct diphone_table_segment nucleus =
+				table_segment(&segs[DIPHONE_NUCLEUS]);
+			// the nucleus must not depend on p2
+			if (p2 == 0) {
+				nuclei[p1] = nucleus;
+			} else if (memcmp(&nucleus, &nuclei[p1],
+			                  sizeof nucleus) != 0) {
+				fprintf(stderr, "nucleus of %d depends on the "
+				        "next phoneme\n", p1);
+				exit(1);
+			}
+			transitions[p1][p2].post =
+				table_segment(&segs[DIPHONE_POST]);
+			transitions[p1][p2].pre =
+				table_segment(&segs[DIPHONE_PRE]);
+		}
+	}
+
+	printf("/* THIS FILE IS AUTO-GENERATED! DO NOT EDIT THIS FILE. */\n\n"
+	       "#include \"juno.h\"\n"
+	       "#include \"diphone.h\"\n"
+	       "#include \"bob.h\"\n\n"
+	       "#if DIPHONE_TABLE\n\n");
+	// the segments are in accumulator units and timeslices
+	printf("#if SAMPLE_RATE != %d || SLICES_PER_SECOND != %d\n"
+	       "#error no diphone tables for this SAMPLE_RATE and "
+	       "SLICES_PER_SECOND (build-schedule builds them for the host)\n"
+	       "#endif\n\n", SAMPLE_RATE, SLICES_PER_SECOND);
+	printf("const Voice *const diphone_table_voice = &%s;\n\n",
+	       XSTR(VOICE));
+
+	printf("const FreqSet diphone_freqs[%d] PROGMEM = {\n", nfreqs);
+	for (i = 0; i < nfreqs; ++i) {
+		printf("\t{ .f = { %d, %d, %d, %d } }, // %d\n",
+		       freqs[i].f[0], freqs[i].f[1], freqs[i].f[2],
+		       freqs[i].f[3], i);
+	}
+	printf("};\n\n");
+
+	// { start, end, nslices, source }
+	printf("const struct diphone_table_segment "
+	       "diphone_nuclei[N_PHONEME] PROGMEM = {\n");
+	for (p1 = 0; p1 < N_PHONEME; ++p1) {
+		printf("\t[%d] = ", p1);
+		print_segment(&nuclei[p1]);
+		printf(",\n");
+	}
+	printf("};\n\n");
+
+	// { post, pre }
+	printf("const struct diphone_table_transition "
+	       "diphone_transitions[N_PHONEME][N_PHONEME] PROGMEM = {\n");
+	for (p1 = 0; p1 < N_PHONEME; ++p1) {
+		printf("\t[%d] = {\n", p1);
+		for (p2 = 0; p2 < N_PHONEME; ++p2) {
+			printf("\t\t[%d] = { ", p2);
+			print_segment(&transitions[p1][p2].post);
+			printf(", ");
+			print_segment(&transitions[p1][p2].pre);
+			printf(" },\n");
+		}
+		printf("\t},\n");
+	}
+	printf("};\n\n#endif\n");
+
+	fprintf(stderr, "%d diphones, %d frequency sets, %zu bytes\n",
+	        N_PHONEME * N_PHONEME, nfreqs,
+	        nfreqs * sizeof *freqs + sizeof nuclei + sizeof transitions);
+	return 0;
+}
@@ -0,0 +1,116 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// generate packed voices (this runs only on a "big" target)
+//
+// usage: build-voice [-elif | -end | -o file]
+//
+// The voice is packed with voice_pack and written out as C, so that small
+// targets can keep only the packed voice in flash. With -o file, it is
+// written to a voice file instead (see voicefile.h), for juno_load_voice.
+//
+// A packed voice is in accumulator units and timeslices, so it is packed at
+// the SAMPLE_RATE and SLICES_PER_SECOND that build-voice is compiled for, from
+// the tables of bob.c for that rate. build-voice is compiled once per rate
+// (see PACKED_RATES in the Makefile), and bobpacked.c is put together from
+// their output as bob.c is by voicec: the first prints the start of the file
+// and its voice behind #if SAMPLE_RATE == ..., every other one (-elif) prints
+// its voice behind #elif, and -end ends the file with an #error for any other
+// rate.
+
+#include "juno.h"
+#include "packed.h"
+#include "voicefile.h"
+#include "bob.h"
+
+// the voice to pack, and the name of the packed voice in C
+#define VOICE voiceBob
+#define PACKED_NAME "packedBob"
+#define FILE_NAME "bob"
+
+static void print_array(const char *indent, const uint8_t *b, int n)
+{
+	int i;
+	for (i = 0; i < n; ++i) {
+		if (i % 12 == 0)
+			printf("%s%s", i ? "\n" : "", indent);
+		printf("%s%u,", i % 12 ? " " : "", b[i]);
+	}
+	printf("\n");
+}
+
+int main(int argc, char *argv[])
+{
+	static PackedVoice pv;
+	int i, t;
+
+	voice_pack(&pv, &VOICE, phonemeFlags);
+
+	if (argc == 3 && strcmp(argv[1], "-o") == 0) {
+		FILE *f = fopen(argv[2], "wb");
+		if (!f || !voice_file_write(f, &pv, FILE_NAME) ||
+		    fclose(f) != 0) {
+			perror(argv[2]);
+			return 1;
+		}
+		return 0;
+	}
+
+	if (argc == 2 && strcmp(argv[1], "-end") == 0) {
+		printf("#else\n"
+		       "#error no packed voice for this SAMPLE_RATE and "
+		       "SLICES_PER_SECOND (add it to PACKED_RATES)\n"
+		       "#endif\n");
+		return 0;
+	}
+	bool elif = argc == 2 && strcmp(argv[1], "-elif") == 0;
+	if (argc > 2 || (argc == 2 && !elif)) {
+		fprintf(stderr, "usage: %s [-elif | -end | -o file]\n", argv[0]);
+		return 1;
+	}
+
+	if (!elif)
+		printf("/* THIS FILE IS AUTO-GENERATED! DO NOT EDIT THIS FILE. */\n\n"
+		       "#include \"juno.h\"\n"
+		       "#include \"packed.h\"\n\n");
+	printf("#%s SAMPLE_RATE == %d && SLICES_PER_SECOND == %d\n\n",
+	       elif ? "elif" : "if", SAMPLE_RATE, SLICES_PER_SECOND);
+	printf("const PackedVoice %s PROGMEM = {\n", PACKED_NAME);
+	printf("\t.pitch = %u,\n", pv.pitch);
+	printf("\t.rate = %u,\n", pv.rate);
+	printf("\t.flags = {\n");
+	for (t = 0; t < PHONEME_TYPE_COUNT; ++t) {
+		const PackedPhonemeFlags *f = &pv.flags[t];
+		printf("\t\t[%d] = { 0x%02x, 0x%02x, %u, %u },\n",
+		       t, f->bits, f->sources, f->ndur, f->tdur);
+	}
+	printf("\t},\n");
+	printf("\t.type = {\n");
+	print_array("\t\t", pv.type, N_PHONEME);
+	printf("\t},\n");
+	printf("\t.f = {\n");
+	for (i = 0; i < N_FREQ-1; ++i) {
+		printf("\t\t[%d] = {\n", i);
+		print_array("\t\t\t", pv.f[i], N_PHONEME);
+		printf("\t\t},\n");
+	}
+	printf("\t},\n");
+	printf("\t.obstargets = {\n");
+	for (t = 0; t < N_OBS; ++t) {
+		printf("\t\t[%d] = {\n", t);
+		for (i = 0; i < N_FREQ-1; ++i) {
+			printf("\t\t\t[%d] = {\n", i);
+			print_array("\t\t\t\t", pv.obstargets[t][i], N_PHONEME);
+			printf("\t\t\t},\n");
+		}
+		printf("\t\t},\n");
+	}
+	printf("\t},\n");
+	printf("};\n\n");
+
+	fprintf(stderr, "%s at %d Hz: %zu bytes (Voice and flags: %zu bytes)\n",
+	        PACKED_NAME, SAMPLE_RATE, sizeof pv,
+	        sizeof VOICE + sizeof phonemeFlags);
+	return 0;
+}
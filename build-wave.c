@@ -182,20 +182,45 @@ int main()
 			//fprintf(stderr, "sine_wavetable[%2d][%2d] = %4d\n", j, i, (int)sine_wavetables[j].samples[i]);
 		}
 	}
+	printf("#if !BUZZ_MULTIPLY\n");
 	printf("const wavetable_t sine_wavetables[BUZZ_WAVETABLE_SCALE] PROGMEM = ");
 	print_wavetables(gen_sine_wavetables, BUZZ_WAVETABLE_SCALE);
 	printf(";\n");
 
+	// full-scale sine for multiply mode
+	wavetable_t gen_sine_wavetable;
+	for (i = 0; i < BUZZ_WAVETABLE_SIZE; ++i) {
+		gen_sine_wavetable.samples[i] =
+		  127 * sin(i * 2 * M_PI / BUZZ_WAVETABLE_SIZE);
+	}
+	printf("#else\n");
+	printf("const wavetable_t sine_wavetable PROGMEM = ");
+	print_wavetable(&gen_sine_wavetable);
+	printf(";\n");
+	printf("#endif\n");
+
 #if 0
 	for (i = 0; i < FRIC_WAVETABLE_SIZE; ++i) {
 		gen_aspiration_wavetable.samples[i] = 127 * ((double)2*rand() / RAND_MAX - 1) / 8;
 	}
 #endif
 
+	printf("#if !FRIC_NOISE_LFSR\n");
 	generate_fric_wavetable("frication_wavetable",
 			FRIC_WAVETABLE_SIZE, FRIC_WAVETABLE_PERIOD, "white");
 	generate_fric_wavetable("soft_frication_wavetable",
 			FRIC_WAVETABLE_SIZE, FRIC_WAVETABLE_PERIOD, "brown");
+	printf("#endif\n");
+
+	printf("#if ENVELOPE_RECIP || FREQ_DDA\n");
+	printf("const unsigned short recip_table[RECIP_MIN] PROGMEM = {");
+	for (i = 0; i < RECIP_MIN; ++i) {
+		if (i % 8 == 0)
+			printf("\n\t");
+		printf("%3d,", 65536 / (RECIP_MIN + i));
+	}
+	printf("\n};\n");
+	printf("#endif\n");
 
 	makebuzz(2.5, "vowel_buzz");
 	makebuzz(2., "nasal_buzz");
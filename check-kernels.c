@@ -0,0 +1,122 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// render kernel conformance check (this runs only on a "big" target)
+//
+// usage: check-kernels [iterations [seed]]
+//
+// Renders random oscillator banks for random numbers of samples with every
+// set of render kernels that this CPU supports (see render_select_kernels),
+// and checks that the samples and the final oscillator state are exactly
+// those of the scalar kernels. Kernels the CPU cannot run are skipped.
+// Exits with status 1 if any kernel differs.
+
+#include "juno.h"
+#include "render.h"
+#include "oscillator.h"
+
+// every name in all_kernels[] in render.c
+static const char *const names[] = {
+	"avx512", "avx2", "ssse3", "neon",
+};
+#define N_NAMES (sizeof names / sizeof *names)
+
+static const struct render_kernels *select_kernels(const char *name)
+{
+	setenv("JUNO_KERNELS", name, 1);
+	return render_select_kernels();
+}
+
+static void random_bank(oscillator_bank *bank)
+{
+	int j;
+	memset(bank, 0, sizeof *bank);
+	for (j = 0; j < N_FORMANTS_FLATOSC; ++j) {
+		bank->freq[j] = rand();
+		bank->phase[j] = rand();
+		bank->wave[j] = rand() % N_WAVE;
+#if BUZZ_MULTIPLY
+		bank->gain[j] = rand() % (SINE_GAIN_MAX + 1);
+#endif
+	}
+}
+
+static void random_fric_bank(fric_oscillator_bank *bank)
+{
+	int j;
+	memset(bank, 0, sizeof *bank);
+	for (j = 0; j < N_FRICATIVE_OSC; ++j) {
+		bank->freq[j] = rand();
+		bank->phase[j] = rand() & 0xffff;
+	}
+#if FRIC_NOISE_LFSR
+	for (j = 0; j < N_FRICATIVE_FLATOSC; ++j) {
+		bank->noise[j] = rand();
+		bank->lfsr[j] = rand() | 1;
+	}
+#endif
+}
+
+int main(int argc, char **argv)
+{
+	const struct render_kernels *scalar, *kernels[N_NAMES];
+	int nkernels = 0;
+	long iterations = argc > 1 ? atol(argv[1]) : 20000;
+	long i, bad = 0;
+	int k;
+
+	srand(argc > 2 ? atoi(argv[2]) : 1);
+	scalar = select_kernels("scalar");
+	for (k = 0; k < N_NAMES; ++k) {
+		const struct render_kernels *kern = select_kernels(names[k]);
+		// render_select_kernels falls back on the best kernels the
+		// CPU supports if it can't run these
+		if (strcmp(kern->name, names[k]) == 0)
+			kernels[nkernels++] = kern;
+	}
+	unsetenv("JUNO_KERNELS");
+	if (nkernels == 0) {
+		printf("check-kernels: only scalar kernels on this CPU\n");
+		return 0;
+	}
+
+	for (i = 0; i < iterations; ++i) {
+		oscillator_bank bank;
+		fric_oscillator_bank fricbank;
+		// up to a whole block, so every SIMD kernel also leaves some
+		// samples to its scalar tail
+		int nsamp = rand() % (BLOCK_SAMPLES + 1);
+
+		random_bank(&bank);
+		random_fric_bank(&fricbank);
+		for (k = 0; k < nkernels; ++k) {
+			oscillator_bank b0 = bank, b1 = bank;
+			fric_oscillator_bank f0 = fricbank, f1 = fricbank;
+			mono8 s0[BLOCK_SAMPLES], s1[BLOCK_SAMPLES];
+
+			scalar->formants(&b0, nsamp, s0);
+			kernels[k]->formants(&b1, nsamp, s1);
+			if (memcmp(s0, s1, nsamp) != 0 ||
+			    memcmp(&b0, &b1, sizeof b0) != 0) {
+				if (bad++ < 10)
+					printf("%s formants differ (%d samples)\n",
+					       kernels[k]->name, nsamp);
+			}
+
+			scalar->fricative(&f0, nsamp, s0);
+			kernels[k]->fricative(&f1, nsamp, s1);
+			if (memcmp(s0, s1, nsamp) != 0 ||
+			    memcmp(&f0, &f1, sizeof f0) != 0) {
+				if (bad++ < 10)
+					printf("%s fricative differs (%d samples)\n",
+					       kernels[k]->name, nsamp);
+			}
+		}
+	}
+
+	for (k = 0; k < nkernels; ++k)
+		printf("%s ", kernels[k]->name);
+	printf("vs scalar: %ld iterations, %ld mismatches\n", iterations, bad);
+	return bad != 0;
+}
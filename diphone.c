@@ -0,0 +1,207 @@
+#include <stdbool.h>
+#include <string.h>
+
+#include "juno.h"
+#include "phonemes.h"
+#include "voice.h"
+#include "packed.h"
+#include "diphone.h"
+
+// get frequency set from read-only memory and convert to proper frequency units
+static FreqSet getFreqSet_PF(const FreqSet *f1)
+{
+	FreqSet f2;
+	memcpy_PF(&f2, f1, sizeof f2);
+	return f2;
+}
+
+static FreqSet freqSetFromPhoneme(const Phoneme *p)
+{
+	return getFreqSet_PF(&p->f);
+}
+
+static PhonemeType typeFromPhoneme(const Phoneme *p)
+{
+	return pgm_read_int(&p->type);
+}
+
+static ObsType obstypeFromPhoneme(const Phoneme *p)
+{
+	return pgm_read_int(&p->obstype);
+}
+
+static FreqSet obstargetsFromPhoneme(const Phoneme *p, ObsType type)
+{
+	return getFreqSet_PF(&p->obstargets[type]);
+}
+
+static void set_segment(struct juno_segment *seg,
+		const FreqSet *start, const FreqSet *end,
+		int nslices, SoundSource source)
+{
+	seg->start = *start;
+	seg->end = *end;
+	seg->nslices = nslices;
+	seg->source = source;
+}
+
+// what planning needs to know about each phoneme of a diphone
+struct plan_phoneme {
+	PhonemeFlags flags;
+	FreqSet f;
+	// obstruent target of this phoneme for the type of the other phoneme
+	// (only if the other phoneme is an obstruent)
+	FreqSet obstarget;
+};
+
+/*
+ * A diphone has three major stages:
+ * - nucleus of first phoneme
+ * - first half of transition (use sound source of first phoneme)
+ * - second half of transition (use sound source of second phoneme)
+ *
+ * The nucleus is generated from the nucleus sound source of the first phoneme.
+ */
+// XXX this function should also take speech modifiers, eg, rate and pitch
+static void plan(const struct plan_phoneme *ph1,
+                 const struct plan_phoneme *ph2,
+                 struct juno_segment segs[DIPHONE_SEGMENTS])
+{
+	const PhonemeFlags *flags1 = &ph1->flags;
+	const PhonemeFlags *flags2 = &ph2->flags;
+	int i;
+	for (i = 0; i < DIPHONE_SEGMENTS; ++i)
+		segs[i].nslices = 0;
+
+	if (flags1->ndur) {
+		FreqSet f = ph1->f;
+		if (f.f[0] != 0)
+			f.f[0] = DIPHONE_F0_A;
+		set_segment(&segs[DIPHONE_NUCLEUS], &f, &f, flags1->ndur, flags1->nsrc);
+	}
+	if (flags1->tdur == 0 && flags2->tdur == 0)
+		return;
+
+	// XXX this does not handle aspirated phoneme (this should be aspirated
+	// but take the frequencies of the following sonorant).
+	FreqSet fsets[4]; // 4 endpoints: 2 for post- and 2 for pre-phoneme
+	if (flags1->obstruent) {
+		fsets[0] = ph2->obstarget;
+	} else {
+		fsets[0] = ph1->f;
+	}
+	if (flags2->obstruent) {
+		fsets[3] = ph1->obstarget;
+	} else {
+		fsets[3] = ph2->f;
+	}
+
+	short dur1 = flags1->tdur;
+	short dur2 = flags2->tdur;
+	if (!flags1->glide || !flags2->glide) {
+		// easy: stair-step transition
+		fsets[1] = fsets[0];
+		fsets[2] = fsets[3];
+	} else {
+		// harder: compute center point using transition durations of
+		// post and pre
+		for (i = 0; i < 4; ++i) {
+			short f0 = fsets[0].f[i];
+			short f3 = fsets[3].f[i];
+			// f1=f2 = d1/(d1+d2) * (f3-f0) + f0
+			// = (d1 * (f3-f0)) / (d1+d2) + f0
+			fsets[1].f[i] = fsets[2].f[i] = ((long)dur1 * (f3-f0)) /
+			                        ((long)dur1 + dur2) + f0;
+		}
+	}
+	// TODO we want voiced phonemes to play during their post segments even
+	// if the next phoneme is silent or aspirated. as it is now, nothing is
+	// voiced because the next phoneme has formants of 0
+	if (dur1) {
+		fsets[0].f[0] = DIPHONE_F0_A;
+		fsets[1].f[0] = DIPHONE_F0_A;
+		// XXX hack for aspirated consonant
+		if (flags1->nsrc == SOURCE_ASPIRATION) {
+			fsets[0].f[1] = fsets[3].f[1];
+			fsets[0].f[2] = fsets[3].f[2];
+			fsets[0].f[3] = fsets[3].f[3];
+		}
+		set_segment(&segs[DIPHONE_POST], &fsets[0], &fsets[1], dur1, flags1->postsrc);
+	}
+	int presrc = flags2->presrc;
+	if (presrc == SOURCE_ASPIRATION) {
+		// XXX hack!
+		// don't play segment before aspiration
+		dur2 = 0;
+	}
+	if (dur2) {
+		fsets[2].f[0] = DIPHONE_F0_A;
+		fsets[3].f[0] = DIPHONE_F0_B;
+		set_segment(&segs[DIPHONE_PRE], &fsets[2], &fsets[3], dur2, presrc);
+	}
+}
+
+void diphone_plan(const Phoneme *p1, const Phoneme *p2,
+                  struct juno_segment segs[DIPHONE_SEGMENTS])
+{
+	struct plan_phoneme ph1, ph2;
+
+	memcpy_PF(&ph1.flags, &phonemeFlags[typeFromPhoneme(p1)],
+	          sizeof ph1.flags);
+	memcpy_PF(&ph2.flags, &phonemeFlags[typeFromPhoneme(p2)],
+	          sizeof ph2.flags);
+	ph1.f = freqSetFromPhoneme(p1);
+	ph2.f = freqSetFromPhoneme(p2);
+	if (ph2.flags.obstruent)
+		ph1.obstarget = obstargetsFromPhoneme(p1, obstypeFromPhoneme(p2));
+	if (ph1.flags.obstruent)
+		ph2.obstarget = obstargetsFromPhoneme(p2, obstypeFromPhoneme(p1));
+	plan(&ph1, &ph2, segs);
+}
+
+static void packed_phoneme(const PackedVoice *v, int p, int other,
+                           struct plan_phoneme *ph)
+{
+	uint8_t type = voice_packed_type(v, p);
+	uint8_t othertype = voice_packed_type(v, other);
+
+	voice_packed_flags(v, type & PACKED_TYPE_MASK, &ph->flags);
+	voice_packed_freqs(v, p, &ph->f);
+	if (pgm_read_byte(&v->flags[othertype & PACKED_TYPE_MASK].bits) &
+	    PACKED_OBSTRUENT)
+		voice_packed_obstargets(v, p, (othertype & PACKED_OBSTYPE_MASK)
+		                        >> PACKED_OBSTYPE_SHIFT, &ph->obstarget);
+}
+
+void diphone_plan_packed(const PackedVoice *v, int p1, int p2,
+                         struct juno_segment segs[DIPHONE_SEGMENTS])
+{
+	struct plan_phoneme ph1, ph2;
+	packed_phoneme(v, p1, p2, &ph1);
+	packed_phoneme(v, p2, p1, &ph2);
+	plan(&ph1, &ph2, segs);
+}
+
+#if DIPHONE_TABLE
+static void lookup_segment(struct juno_segment *seg,
+		const struct diphone_table_segment *t)
+{
+	seg->nslices = pgm_read_byte(&t->nslices);
+	if (seg->nslices == 0)
+		return;
+	memcpy_PF(&seg->start, &diphone_freqs[pgm_read_word(&t->start)],
+	          sizeof seg->start);
+	memcpy_PF(&seg->end, &diphone_freqs[pgm_read_word(&t->end)],
+	          sizeof seg->end);
+	seg->source = pgm_read_byte(&t->source);
+}
+
+void diphone_lookup(int p1, int p2, struct juno_segment segs[DIPHONE_SEGMENTS])
+{
+	const struct diphone_table_transition *t =
+		&diphone_transitions[p1][p2];
+	lookup_segment(&segs[DIPHONE_NUCLEUS], &diphone_nuclei[p1]);
+	lookup_segment(&segs[DIPHONE_POST], &t->post);
+	lookup_segment(&segs[DIPHONE_PRE], &t->pre);
+}
+#endif
@@ -0,0 +1,82 @@
+#ifndef _DIPHONE_H_
+#define _DIPHONE_H_
+
+#include <stdint.h>
+
+#include "juno.h"
+#include "phonemes.h"
+#include "voice.h"
+#include "packed.h"
+
+/*
+ * Diphone schedules
+ *
+ * The segments of a diphone (see juno_plan_diphone) depend only on the two
+ * phonemes and the voice, except for F0, which follows the pitch modulation of
+ * the juno object. So the schedule is planned with a marker in place of each
+ * F0 (the f[0] of the start and end frequencies), which the caller replaces
+ * with the modulated pitch before queueing the segments:
+ *
+ * DIPHONE_F0_NONE  unvoiced (0)
+ * DIPHONE_F0_A     pitch at the start of the diphone
+ * DIPHONE_F0_B     pitch at the end of the diphone
+ *
+ * diphone_plan works out the schedule from the phoneme data. On targets with
+ * DIPHONE_TABLE, build-schedule runs it for every pair of phonemes of a voice
+ * and writes the results to schedule.c, and diphone_lookup copies a schedule
+ * from there instead.
+ */
+enum {
+	DIPHONE_F0_NONE,
+	DIPHONE_F0_A,
+	DIPHONE_F0_B,
+};
+
+// segments of a diphone: the nucleus of p1, then the transition from p1
+// (post) and the transition to p2 (pre)
+enum {
+	DIPHONE_NUCLEUS,
+	DIPHONE_POST,
+	DIPHONE_PRE,
+	DIPHONE_SEGMENTS,
+};
+
+// plan the segments of the diphone p1 p2
+// segments that are not to be played have nslices 0
+void diphone_plan(const Phoneme *p1, const Phoneme *p2,
+                  struct juno_segment segs[DIPHONE_SEGMENTS]);
+// the same for phoneme indices p1 p2 of a packed voice
+void diphone_plan_packed(const PackedVoice *v, int p1, int p2,
+                         struct juno_segment segs[DIPHONE_SEGMENTS]);
+
+/*
+ * Precompiled schedules (schedule.c)
+ *
+ * Every segment is stored as indices into a pool of distinct frequency sets
+ * (with F0 markers). The nucleus depends only on the first phoneme, so it is
+ * kept in a table of its own. A segment with nslices 0 is not played.
+ */
+struct diphone_table_segment {
+	uint16_t start, end; // indices into diphone_freqs
+	uint8_t nslices;
+	uint8_t source; // SoundSource
+};
+
+struct diphone_table_transition {
+	struct diphone_table_segment post, pre;
+};
+
+#if DIPHONE_TABLE
+// voice that the tables were built for
+extern const Voice *const diphone_table_voice;
+extern const FreqSet diphone_freqs[] PROGMEM;
+extern const struct diphone_table_segment diphone_nuclei[N_PHONEME] PROGMEM;
+extern const struct diphone_table_transition
+	diphone_transitions[N_PHONEME][N_PHONEME] PROGMEM;
+
+// copy the schedule of the diphone of phoneme indices p1 p2 of
+// diphone_table_voice, as diphone_plan would plan it
+void diphone_lookup(int p1, int p2, struct juno_segment segs[DIPHONE_SEGMENTS]);
+#endif
+
+#endif
@@ -8,6 +8,8 @@
 #include "render.h"
 #include "phonemes.h"
 #include "bob.h"
+#include "packed.h"
+#include "diphone.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -18,25 +20,118 @@
 #if BIG_TARGET
 #include <time.h>
 #include <errno.h>
+#include "voicefile.h"
 #elif defined(_AVR_)
 #endif
 
-#define PITCH_MODULATION_CYCLE 16
+#if SLICE_SAMPLES % FREQ_SUBSLICES != 0
+#error FREQ_SUBSLICES must divide SLICE_SAMPLES
+#endif
+#if BUZZ_DECIMATION != 1 && BUZZ_DECIMATION != 2 && BUZZ_DECIMATION != 4
+#error BUZZ_DECIMATION must be 1, 2, or 4
+#endif
+#if SUBSLICE_SAMPLES % BUZZ_DECIMATION != 0
+#error BUZZ_DECIMATION must divide SUBSLICE_SAMPLES
+#endif
+// big targets can switch between multirate and full rate buzz at run time
+#define BUZZ_MULTIRATE (BIG_TARGET || BUZZ_DECIMATION > 1)
+#if SEGMENT_QUEUE_SIZE & (SEGMENT_QUEUE_SIZE - 1) || SEGMENT_QUEUE_SIZE >= 256
+#error SEGMENT_QUEUE_SIZE must be a power of 2 smaller than 256
+#endif
 
 struct juno {
+	// true if juno_create allocated this object (rather than the caller)
+	bool allocated;
+
         void (*write_sample)(mono8 sample);
 
+	// block output sink
+	juno_block_fn write_block;
+	void *block_ctx;
+	// optional silence sink (shares block_ctx)
+	juno_silence_fn write_silence;
+	// optional timeslice recorder
+	juno_record_fn record;
+	void *record_ctx;
+
+	struct juno_stats stats;
+	// rendered samples (one timeslice, or up to BLOCK_SLICES timeslices
+	// of a steady segment)
+	mono8 block[BLOCK_SAMPLES];
+
+	// best render kernels for this CPU
+	const struct render_kernels *kernels;
+
+#if BUZZ_MULTIRATE
+	// buzz is rendered at 1/decimation of the sample rate and interpolated
+	// by log2(decimation) half-band stages
+	// upsampling is true while the interpolators hold buzz from the last
+	// segment
+	uint8_t decimation;
+	bool upsampling;
+	struct halfband upsample[2];
+#endif
+
+	// the voice: a Voice, or a packed voice if packed is not NULL
 	Voice const*voice;
+	PackedVoice const*packed;
+#if BIG_TARGET
+	// voice handle that packed follows, if attached (see voicefile.h)
+	struct juno_voice_reader reader;
+#endif
+
+	// oscillators, kept from one segment to the next so their phases
+	// carry on
+	oscillator_bank formantosc;
+	fric_oscillator_bank fricosc;
 
 	int pitch_phase;
 
-        // TODO add voice/speech parameters here
-        // TODO add pitch modulation table here
-	unsigned short modulated_pitch[PITCH_MODULATION_CYCLE];
+	// last phoneme spoken by juno_speak_phone
+	int lastp;
+#if JUNO_TRACE
+	char lastc;
+#endif
+
+	// segments planned but not rendered yet
+	// queue[queue_head] is the oldest; head and tail count up and wrap
+	struct juno_segment queue[SEGMENT_QUEUE_SIZE];
+	uint8_t queue_head, queue_tail;
+
+	// the pitch modulation, pitch, and rate of the voice
+	unsigned short voice_pitch[PITCH_MODULATION_CYCLE];
+	unsigned short voice_f0;
+	unsigned short voice_rate;
+
+	// options (see juno_getoptions)
+	signed char voice_index;
+	signed char pitch;
+	uint8_t pitch_modulation;
+	unsigned short rate;
+
+	// tables for the options: tables[table] is in use, and changing an
+	// option builds the other one, which the next diphone switches to
+	// (see build_tables)
+	struct option_tables {
+		unsigned short modulated_pitch[PITCH_MODULATION_CYCLE];
+		// durations (in timeslices) at the rate, for durations at
+		// the rate of the voice up to DURATION_TABLE_SIZE - 1
+		uint8_t durations[DURATION_TABLE_SIZE];
+		// the same in 8.8 fixed point, for longer durations
+		unsigned short duration_scale;
+	} tables[2];
+	uint8_t table;
+	bool tables_pending;
 };
 
+#if BUZZ_MULTIPLY
+extern const wavetable_t sine_wavetable PROGMEM;
+#else
 extern const wavetable_t sine_wavetables[BUZZ_WAVETABLE_SCALE] PROGMEM;
+#endif
+#if !FRIC_NOISE_LFSR
 extern const fric_wavetable_t frication_wavetable PROGMEM;
+#endif
 extern const fric_wavetable_t aspiration_wavetable PROGMEM;
 extern const wavetable_t vowel_buzz PROGMEM, nasal_buzz PROGMEM, liquid_buzz PROGMEM, frication_buzz PROGMEM;
 
@@ -48,11 +143,14 @@ Hierarchy of sound fragments (smallest first):
 - diphone (two phones)
 
 - render_* routines convert timeslices to samples
-- speak_formant_segment/speak_frication_segment/speak_silence_segment convert
-  segments to timeslices; call render_* for each timeslice
-- juno_speak_diphone converts diphone (two phone endpoints) to segments; calls
-  speak_formant_segment/speak_frication_segment/speak_silence_segment for each
-  segment
+- juno_speak_segment converts segments to timeslices; calls render_* for each
+  timeslice
+- juno_plan_diphone converts diphone (two phone endpoints) to segments and
+  queues them (struct juno_segment); the segments are planned by diphone_plan
+  or looked up in the precompiled schedules (see diphone.h)
+- juno_render_segments takes segments off the queue; calls juno_speak_segment
+  for each segment
+- juno_speak_diphone calls juno_plan_diphone then juno_render_segments
 - juno_speak_phones converts a string of phones into diphones; calls
   juno_speak_diphone for each diphone
 - speak_english will convert a string of English text into phones; calls
@@ -100,8 +198,78 @@ static void copy_wavetable(oscillator *osc, const wavetable_t *from)
  * 2014-03-05
  * Oscillator phases may be either synchronized with F0 or not with the
  * SYNC_PHASES macro.
+ *
+ * SYNC_PHASES 1 already keeps each oscillator's phase continuous across
+ * slices: while an oscillator plays harmonic h, its phase is h * p0 plus a
+ * constant, and resetting it to h * p0 is where it would have been anyway.
  */
 #define SYNC_PHASES 1
+
+#if ENVELOPE_RECIP || FREQ_DDA
+/*
+ * Division by f0 without a divide instruction, for calc_envelope.
+ *
+ * f0 is normalized to m*2^e with RECIP_MIN <= m < 2*RECIP_MIN, and n/f0 is
+ * estimated as n * (65536/m) / 2^(16+e) from recip_table. Dropping the low
+ * bits of f0 and rounding 65536/m down make the estimate q' satisfy
+ *
+ *	|q' - n/f0| <= (n/f0)/RECIP_MIN + 1
+ *
+ * so it is off by at most 1 for the amplitudes and at most 2 for harmonic
+ * numbers below 128. A multiply-and-compare correction step then makes it
+ * exactly floor(n/f0), so the envelope is identical to the one calculated
+ * with division.
+ */
+struct recip {
+	unsigned short r;
+	uint8_t shift;
+};
+
+static void recip_init(struct recip *rc, unsigned short d)
+{
+	uint8_t shift = 16;
+	while (d >= 2*RECIP_MIN) {
+		d >>= 1;
+		++shift;
+	}
+	while (d < RECIP_MIN) {
+		d <<= 1;
+		--shift;
+	}
+	rc->r = pgm_read_word(&recip_table[d - RECIP_MIN]);
+	rc->shift = shift;
+}
+
+// n must be less than 2^21 so n * r fits in 32 bits
+static unsigned long recip_div(const struct recip *rc, unsigned long n,
+                               unsigned short d)
+{
+	unsigned long q = (n * rc->r) >> rc->shift;
+	while (q * d > n)
+		--q;
+	while ((q + 1) * d <= n)
+		++q;
+	return q;
+}
+
+// floor(n * 65536 / d), by long division in base 256 with recip_div
+// d must be less than RECIP_DIV16_MAX (r << 8 must be less than 2^21)
+#define RECIP_DIV16_MAX 8192
+static unsigned long recip_div16(const struct recip *rc, unsigned short n,
+                                 unsigned short d)
+{
+	unsigned long q = recip_div(rc, n, d);
+	unsigned long r = n - q * d;
+	int i;
+	for (i = 0; i < 2; ++i) {
+		unsigned long qi = recip_div(rc, r << 8, d);
+		r = (r << 8) - qi * d;
+		q = (q << 8) + qi;
+	}
+	return q;
+}
+#endif
+
 /*
  * For each formant we calculate the frequencies, phases, and amplitudes of one
  * harmonic above and one harmonic below the formant frequency. The frequencies
@@ -119,10 +287,8 @@ static void copy_wavetable(oscillator *osc, const wavetable_t *from)
  * on the quality and intelligibility of synthesized speech, and I understand
  * that to include the choice of window function as well.
  */
-static void calc_envelope(const FreqSet *freqs, oscillator osc[],
-                          const wavetable_t *buzz,
-                          const wavetable_t *wavetables,
-                          int samples)
+static void calc_envelope(const FreqSet *freqs, oscillator_bank *bank,
+                          uint8_t buzz, uint8_t wavetables)
 {
 #if 0
 	// TODO maintain phases for all harmonics up to the maximum value for F3
@@ -141,8 +307,21 @@ static void calc_envelope(const FreqSet *freqs, oscillator osc[],
 #endif
 	// base frequency
 	long f0 = freqs->f[0];
+#if ENVELOPE_RECIP
+	struct recip rf0;
+	if (f0 != 0)
+		recip_init(&rf0, f0);
+# define DIV_F0(n) ((long)recip_div(&rf0, (n), f0))
+#else
+# define DIV_F0(n) ((n) / f0)
+#endif
 	// amplitude of this formant (supplied as input?)
+	// this is a gain in multiply mode or a sine wavetable index otherwise
+#if BUZZ_MULTIPLY
+	long amp = SINE_GAIN_MAX;
+#else
 	long amp = BUZZ_WAVETABLE_SCALE - 1;
+#endif
 
 	// frequency of a formant
 	long ff;
@@ -154,17 +333,16 @@ static void calc_envelope(const FreqSet *freqs, oscillator osc[],
 	// amplitudes of harmonics
 	long amph[2];
 
-	osc->freq  = f0;
-	//osc->phase = phases[1];
-	osc->waveform = buzz;
+	bank->freq[0] = f0;
+	//bank->phase[0] = phases[1];
+	bank->wave[0] = buzz;
 
 #if SYNC_PHASES
-	long p0 = osc->phase; // phase of first oscillator
+	long p0 = bank->phase[0]; // phase of first oscillator
 #endif
-
-	++osc;
-
+	int osc;
 	int f;
+	osc = 1;
 	for (f = 1; f < N_FREQ; ++f) {
 		h = 0;
 		if (f0 == 0) {
@@ -172,34 +350,45 @@ static void calc_envelope(const FreqSet *freqs, oscillator osc[],
 			amph[0] = amph[1] = 0;
 		} else {
 			ff = freqs->f[f];
-			h = ff / f0;
+			h = DIV_F0(ff);
 
 			fh[0] = h * f0;
 			fh[1] = fh[0] + f0;
 
-			amph[0] = amp * (fh[1] - ff) / f0;
+			amph[0] = DIV_F0(amp * (fh[1] - ff));
 			amph[1] = amp - amph[0];
 		}
 
 		// attenuate amplitude for higher formants
 		amp = amp * 3 / 4;
 
-		osc->freq  = fh[0];
+		bank->freq[osc] = fh[0];
 #if SYNC_PHASES
-		osc->phase = h * p0; // XXX
+		bank->phase[osc] = h * p0; // XXX
+#endif
+		//bank->phase[osc] = phases[h];
+#if BUZZ_MULTIPLY
+		bank->wave[osc] = wavetables;
+		bank->gain[osc] = amph[0];
+#else
+		bank->wave[osc] = wavetables + amph[0];
 #endif
-		//osc->phase = phases[h];
-		osc->waveform = &wavetables[amph[0]];
 		++osc;
 
-		osc->freq  = fh[1];
+		bank->freq[osc] = fh[1];
 #if SYNC_PHASES
-		osc->phase = (h+1) * p0; // XXX
+		bank->phase[osc] = (h+1) * p0; // XXX
+#endif
+		//bank->phase[osc] = phases[h+1];
+#if BUZZ_MULTIPLY
+		bank->wave[osc] = wavetables;
+		bank->gain[osc] = amph[1];
+#else
+		bank->wave[osc] = wavetables + amph[1];
 #endif
-		//osc->phase = phases[h+1];
-		osc->waveform = &wavetables[amph[1]];
 		++osc;
 	}
+#undef DIV_F0
 #if 0
 	// update all phases for next time
 	int n = samples;
@@ -211,28 +400,32 @@ static void calc_envelope(const FreqSet *freqs, oscillator osc[],
 }
 
 
-static void calc_frication(const FreqSet *freqs, fric_oscillator osc[])
+static void calc_frication(const FreqSet *freqs, fric_oscillator_bank *bank)
 {
 	// XXX freqs[0] is the voice bar if it is non-zero
 	// it is the last oscillator
-	long f;
-	for (f = 1; f < 4; ++f) {
-		osc->freq = freqs->f[f];
-		if (osc->freq == 0)
-			osc->phase = 0;
-		++osc;
+	int f;
+	for (f = 1; f < N_FREQ; ++f) {
+		bank->freq[f-1] = freqs->f[f];
+		if (bank->freq[f-1] == 0)
+			bank->phase[f-1] = 0;
+#if FRIC_NOISE_LFSR
+		// xorshift gets stuck at 0, so seed each generator differently
+		if (bank->lfsr[f-1] == 0)
+			bank->lfsr[f-1] = 0xace1 + f;
+#endif
 	}
 	// voice bar
-	osc->freq = freqs->f[0];
+	bank->freq[N_FRICATIVE_FLATOSC] = freqs->f[0];
 	if (freqs->f[0] == 0) {
-		osc->phase = 0;
+		bank->phase[N_FRICATIVE_FLATOSC] = 0;
 	}
 }
 
 #define UNDUR(sl)  ((double)(sl) * 1000 / SLICES_PER_SECOND)
 #define UNFREQ(au) ((double)(au) * SAMPLE_RATE / 65536)
 
-#if BIG_TARGET
+#if JUNO_TRACE
 // print FreqSet, assuming in accumulator units (not Hz)
 static void printFreqSet(const FreqSet *f)
 {
@@ -244,9 +437,110 @@ static void printFreqSet(const FreqSet *f)
 }
 #endif
 
-// number of samples in a slice
-#define SLICE_SAMPLES (SAMPLE_RATE/SLICES_PER_SECOND)
+// true if every frequency in a is within tolerance of the one in b
+static bool freqs_within(const FreqSet *a, const FreqSet *b, long tolerance)
+{
+	int f;
+	for (f = 0; f < N_FREQ; ++f) {
+		long d = (long)a->f[f] - b->f[f];
+		if (d > tolerance || d < -tolerance)
+			return false;
+	}
+	return true;
+}
+
+/*
+ * Render nsamp samples with the current envelope of bank (or of fricbank if
+ * bank is NULL), appending them to the filled samples already in
+ * juno->block, and write the block to the sink whenever it fills up. Return
+ * the number of samples left in the block.
+ */
+#if BUZZ_MULTIRATE
+/*
+ * Render n samples of buzz at 1/juno->decimation of the sample rate and
+ * interpolate them up to the full rate in place. Each oscillator steps
+ * decimation times as far per sample (wrapping exactly as decimation steps
+ * at the full rate would), so the phases end up where rendering at the full
+ * rate would leave them.
+ */
+static void render_formants_multirate(struct juno *juno, oscillator_bank *bank,
+                                      int n, mono8 *out)
+{
+	unsigned short freq[N_FORMANTS_FLATOSC];
+	int j, d;
+
+	memcpy(freq, bank->freq, sizeof freq);
+	for (j = 0; j < N_FORMANTS_FLATOSC; ++j)
+		bank->freq[j] = freq[j] * juno->decimation;
+	juno->kernels->formants(bank, n / juno->decimation, out);
+	memcpy(bank->freq, freq, sizeof freq);
+
+	if (!juno->upsampling) {
+		memset(juno->upsample, 0, sizeof juno->upsample);
+		juno->upsampling = true;
+	}
+	for (d = juno->decimation, j = 0; d > 1; d /= 2, ++j)
+		render_upsample2(&juno->upsample[j], out, n / d, out);
+}
+#endif
+
+static int render_run(struct juno *juno, oscillator_bank *bank,
+                      fric_oscillator_bank *fricbank, int nsamp, int filled)
+{
+	while (nsamp > 0) {
+		int n = BLOCK_SAMPLES - filled;
+		if (n > nsamp)
+			n = nsamp;
+#if BUZZ_MULTIRATE
+		if (bank && juno->decimation > 1)
+			render_formants_multirate(juno, bank, n,
+			                          juno->block + filled);
+		else
+#endif
+		if (bank)
+			juno->kernels->formants(bank, n, juno->block + filled);
+		else
+			juno->kernels->fricative(fricbank, n, juno->block + filled);
+		filled += n;
+		nsamp -= n;
+		if (filled == BLOCK_SAMPLES) {
+			juno->write_block(juno->block_ctx, juno->block, filled);
+			filled = 0;
+		}
+	}
+	return filled;
+}
+
+#if FREQ_DDA
+/*
+ * Slope of a line from a to b in steps steps, in 16.16 fixed point. The
+ * magnitude is exact (rounded toward zero), so a glide never overshoots its
+ * end frequency and ends within one accumulator unit of it.
+ *
+ * The slope is returned as an unsigned long so it can be added to a 16.16
+ * frequency with wrapping arithmetic even when it is negative.
+ */
+static unsigned long dda_slope(long a, long b, int steps)
+{
+	struct recip rc;
+	unsigned long slope;
+	// segments this long (over half a minute) are rare enough to divide
+	if (steps >= RECIP_DIV16_MAX) {
+		slope = ((unsigned long)(b >= a ? b - a : a - b) << 16) / steps;
+		return b >= a ? slope : -slope;
+	}
+	recip_init(&rc, steps);
+	if (b >= a) {
+		slope = recip_div16(&rc, b - a, steps);
+	} else {
+		slope = -recip_div16(&rc, a - b, steps);
+	}
+	return slope;
+}
+#endif
 
+// With FREQ_DDA, frequencies are interpolated in 16.16 fixed point, which
+// takes care of the TODO below.
 // TODO take frequencies in fixed-point so the frequency slopes can be
 // calculated more precisely
 // or use a set of fixed-point deltas
@@ -261,7 +555,7 @@ void juno_speak_segment(struct juno *juno,
 {
 	int i;
 
-#if BIG_TARGET
+#if JUNO_TRACE
 	static const char *sources[] = {
 		[SOURCE_SILENCE] = "silence",
 		[SOURCE_ASPIRATION] = "aspiration",
@@ -275,23 +569,50 @@ void juno_speak_segment(struct juno *juno,
 	printFreqSet(end);
 #endif
 
+#if BUZZ_MULTIRATE
+	// buzz starts again from silence after any other source (the last
+	// HALFBAND_TAPS samples of the previous buzz are never played)
+	if (source < SOURCE_BUZZ)
+		juno->upsampling = false;
+#endif
+
 	if (source == SOURCE_SILENCE) {
-		render_silence(nslices * SLICE_SAMPLES, juno->write_sample);
+		if (juno->record) {
+			static const FreqSet none;
+			juno->record(juno->record_ctx, source, &none, nslices);
+		}
+		if (juno->write_silence) {
+			juno->write_silence(juno->block_ctx,
+			                    (long)nslices * SLICE_SAMPLES);
+			return;
+		}
+		// the sink may not modify the block, so one block of silence
+		// can be handed over as many times as we need
+		render_silence(BLOCK_SAMPLES, juno->block);
+		for (i = 0; i < nslices; i += BLOCK_SLICES) {
+			int n = nslices - i < BLOCK_SLICES ?
+			        nslices - i : BLOCK_SLICES;
+			juno->write_block(juno->block_ctx, juno->block,
+			                  n * SLICE_SAMPLES);
+		}
 		return;
 	}
 
 	bool isFormants = source >= SOURCE_BUZZ;
 
-	// formant oscillators are static so we can maintain phases
-	// XXX we should maintain the phase for every harmonic up to the
-	// maximum value of F3, rather than per-oscillator (because oscillators
-	// may shift to different harmonics during their lifetimes)
-	static oscillator formantosc[2*(N_FREQ-1)+1];
-	static fric_oscillator fricosc[N_FREQ+1];
 	FreqSet freqs;
 
-	// XXX fslopes might need to be fixed-point
+	// slope of each frequency per step (FREQ_SUBSLICES steps per timeslice)
+	// with FREQ_DDA, the slopes and ffix, the running frequencies, are in
+	// 16.16 fixed point
+#if FREQ_DDA
+	unsigned long fslopes[N_FREQ];
+	unsigned long ffix[N_FREQ];
+#else
 	long fslopes[N_FREQ];
+#endif
+	// interpolate over all steps so the last step has the end frequency
+	int steps = nslices * FREQ_SUBSLICES;
 
 	int f;
 	for (f = 0; f < N_FREQ; ++f) {
@@ -330,15 +651,25 @@ void juno_speak_segment(struct juno *juno,
 		} else {
 			// normal case: calculate slope of frequencies between
 			// start and end, inclusive
-			// nslices - 1 forces the inclusion of the end
+			// steps - 1 forces the inclusion of the end
 			// frequency in the last timeslice
+#if FREQ_DDA
+			fslopes[f] = dda_slope(a, b, steps - 1);
+#else
 			fslopes[f] = ((long)b - (long)a) /
-			             ((long)nslices - 1);
+			             ((long)steps - 1);
+#endif
 		}
 	}
 
-	const wavetable_t *wavetable = NULL;
-	const wavetable_t *buzz = NULL;
+#if FREQ_DDA
+	// start at the middle of the first unit so truncating rounds
+	for (f = 0; f < N_FREQ; ++f)
+		ffix[f] = ((unsigned long)freqs.f[f] << 16) + 0x8000;
+#endif
+
+	uint8_t wavetable = WAVE_SINE;
+	uint8_t buzz = WAVE_SINE;
 	switch (source) {
 	default:
 		break;
@@ -346,280 +677,226 @@ void juno_speak_segment(struct juno *juno,
 		// no voice bar for aspiration
 		freqs.f[0] = 0;
 		fslopes[0] = 0;
+#if FREQ_DDA
+		ffix[0] = 0;
+#endif
 		//wavetable = &aspiration_wavetable; // XXX
 		//wavetable = &frication_wavetable;
 		break;
 	case SOURCE_FRICATION:
 		//wavetable = &frication_wavetable;
-		buzz = &frication_buzz; // only for voiced fricatives
+		buzz = WAVE_FRICATION_BUZZ; // only for voiced fricatives
 		break;
 	case SOURCE_BUZZ:
-		wavetable = &sine_wavetables[0];
+		wavetable = WAVE_SINE;
 #if BIG_TARGET
 		//fprintf(stderr, "using vowel_buzz\n");
 #endif
-		buzz = &vowel_buzz;
+		buzz = WAVE_VOWEL_BUZZ;
 		break;
 #if 0
 	case SOURCE_NASAL:
-		wavetable = &sine_wavetables[0];
-		buzz = &nasal_buzz;
+		wavetable = WAVE_SINE;
+		buzz = WAVE_NASAL_BUZZ;
 		break;
 	case SOURCE_LIQUID:
-		wavetable = &sine_wavetables[0];
-		buzz = &liquid_buzz;
+		wavetable = WAVE_SINE;
+		buzz = WAVE_LIQUID_BUZZ;
 		break;
 #endif
 	}
 
-	for (i = 0; i < nslices; ++i) {
-
-		if (isFormants) {
-			// calculate envelope for each timeslice as frequencies
-			// change
-			calc_envelope(&freqs, formantosc, buzz, wavetable, SLICE_SAMPLES);
-
-			// put rubber to asphalt with the oscillators
-			render_formants(formantosc, SLICE_SAMPLES, juno->write_sample);
-		} else {
-			calc_frication(&freqs, fricosc);
+	// Adaptive slicing: the envelope is only recalculated when a frequency
+	// has moved more than SLICE_TOLERANCE from the frequencies it was last
+	// calculated for. Until then, steps are merged and rendered together
+	// in long kernel calls; a steady segment (eg, the nucleus of a phoneme)
+	// is one long run. Fast glides still get a new envelope every step (up
+	// to FREQ_SUBSLICES per timeslice).
+	//
+	// With a tolerance of 0, only steps with identical frequencies are
+	// merged, which produces the same samples as recalculating the envelope
+	// every step: with SYNC_PHASES, calc_envelope sets each harmonic's
+	// phase to h * p0, which is exactly where a free-running oscillator at
+	// h * f0 would be anyway.
+	oscillator_bank *bank = isFormants ? &juno->formantosc : NULL;
+	FreqSet envfreqs;
+	int run = 0; // samples to render with the current envelope
+	int filled = 0; // samples in juno->block
+	for (i = 0; i < steps; ++i) {
+		if (i == 0 || !freqs_within(&freqs, &envfreqs, SLICE_TOLERANCE)) {
+			filled = render_run(juno, bank, &juno->fricosc, run, filled);
+			run = 0;
+			envfreqs = freqs;
+			if (isFormants) {
+				// calculate envelope as frequencies change
+				calc_envelope(&freqs, &juno->formantosc, buzz, wavetable);
+			} else {
+				calc_frication(&freqs, &juno->fricosc);
+			}
+			++juno->stats.envelopes;
+		}
+		++juno->stats.steps;
 
-			render_fricative(fricosc, SLICE_SAMPLES, juno->write_sample);
+		if (juno->record && i % FREQ_SUBSLICES == 0)
+			juno->record(juno->record_ctx, source, &envfreqs, 1);
 
-		}
+		run += SUBSLICE_SAMPLES;
 
 		// update the base phase
 		//p0 += freqs.f[0] * SLICE_SAMPLES;
 
-		// update frequencies for the next timeslice
+		// update frequencies for the next step
 		for (f = 0; f < N_FREQ; ++f) {
+#if FREQ_DDA
+			ffix[f] += fslopes[f];
+			freqs.f[f] = ffix[f] >> 16;
+#else
 			freqs.f[f] += fslopes[f];
+#endif
 		}
 	}
+	// put rubber to asphalt with the oscillators
+	filled = render_run(juno, bank, &juno->fricosc, run, filled);
+	if (filled)
+		juno->write_block(juno->block_ctx, juno->block, filled);
 }
 
-
-
-
-
-
-
-
-
-static bool glideFromPhonemeFlags(const PhonemeFlags *f)
-{
-	return pgm_read_byte(&f->glide);
-}
-
-static uint8_t obstruentFromPhonemeFlags(const PhonemeFlags *f)
+void juno_queue_segment(struct juno *juno, const struct juno_segment *seg)
 {
-	return pgm_read_byte(&f->obstruent);
+	if (juno_queued_segments(juno) == SEGMENT_QUEUE_SIZE)
+		juno_render_segments(juno, 1);
+	juno->queue[juno->queue_tail++ % SEGMENT_QUEUE_SIZE] = *seg;
 }
 
-static uint8_t presrcFromPhonemeFlags(const PhonemeFlags *f)
+int juno_queued_segments(struct juno const *juno)
 {
-	return pgm_read_byte(&f->presrc);
+	return (uint8_t)(juno->queue_tail - juno->queue_head);
 }
 
-static uint8_t postsrcFromPhonemeFlags(const PhonemeFlags *f)
+const struct juno_segment *juno_peek_segment(struct juno const *juno, int i)
 {
-	return pgm_read_byte(&f->postsrc);
+	if (i < 0 || i >= juno_queued_segments(juno))
+		return NULL;
+	return &juno->queue[(uint8_t)(juno->queue_head + i) % SEGMENT_QUEUE_SIZE];
 }
 
-static short nsrcFromPhonemeFlags(const PhonemeFlags *f)
+int juno_render_segments(struct juno *juno, int max)
 {
-	return pgm_read_byte(&f->nsrc);
+	int n = 0;
+	while (n != max && juno_queued_segments(juno) > 0) {
+		const struct juno_segment *seg =
+			&juno->queue[juno->queue_head % SEGMENT_QUEUE_SIZE];
+		juno_speak_segment(juno, &seg->start, &seg->end,
+		                   seg->nslices, seg->source);
+		++juno->queue_head;
+		++n;
+	}
+	return n;
 }
 
-static short ndurFromPhonemeFlags(const PhonemeFlags *f)
+static short scale_duration(const struct option_tables *t, short nslices)
 {
-	return (pgm_read_short(&f->ndur));
+	if (nslices < DURATION_TABLE_SIZE)
+		return t->durations[nslices];
+	return ((long)nslices * t->duration_scale + 128) >> 8;
 }
 
-static short tdurFromPhonemeFlags(const PhonemeFlags *f)
+/*
+ * Queue the planned segments of a diphone with the modulated pitch in place
+ * of their F0 markers, and their durations scaled to the rate. Options set
+ * since the last diphone take effect here.
+ */
+static void queue_diphone(struct juno *juno,
+                          struct juno_segment segs[DIPHONE_SEGMENTS])
 {
-	return (pgm_read_short(&f->tdur));
-}
+	if (juno->tables_pending) {
+		juno->table ^= 1;
+		juno->tables_pending = false;
+	}
+	const struct option_tables *t = &juno->tables[juno->table];
 
-// get frequency set from read-only memory and convert to proper frequency units
-static FreqSet getFreqSet_PF(const FreqSet *f1)
-{
-	FreqSet f2;
-	memcpy_PF(&f2, f1, sizeof f2);
-	return f2;
-}
+	// modulate F0
 
-static FreqSet freqSetFromPhoneme(const Phoneme *p)
-{
-	return getFreqSet_PF(&p->f);
-}
+	unsigned short f0a = t->modulated_pitch[juno->pitch_phase];
+	if (++juno->pitch_phase >= PITCH_MODULATION_CYCLE)
+		juno->pitch_phase = 0;
+	unsigned short f0b = t->modulated_pitch[juno->pitch_phase];
 
-static PhonemeType typeFromPhoneme(const Phoneme *p)
-{
-	return pgm_read_int(&p->type);
+	// F0 for each marker
+	const unsigned short f0[] = {
+		[DIPHONE_F0_NONE] = 0,
+		[DIPHONE_F0_A] = f0a,
+		[DIPHONE_F0_B] = f0b,
+	};
+	int i;
+	for (i = 0; i < DIPHONE_SEGMENTS; ++i) {
+		if (segs[i].nslices == 0)
+			continue;
+		segs[i].start.f[0] = f0[segs[i].start.f[0]];
+		segs[i].end.f[0] = f0[segs[i].end.f[0]];
+		segs[i].nslices = scale_duration(t, segs[i].nslices);
+		juno_queue_segment(juno, &segs[i]);
+	}
 }
 
-static ObsType obstypeFromPhoneme(const Phoneme *p)
-{
-	return pgm_read_int(&p->obstype);
-}
+static void use_packed_voice(struct juno *juno, PackedVoice const*voice);
+static void use_default_voice(struct juno *juno);
+static void detach_voice(struct juno *juno);
 
-static FreqSet obstargetsFromPhoneme(const Phoneme *p, ObsType type)
+// at a diphone boundary, switch to the current voice of the voice handle (if
+// any); this takes no lock
+static void follow_voice(struct juno *juno)
 {
-	return getFreqSet_PF(&p->obstargets[type]);
+#if BIG_TARGET
+	if (juno->reader.handle) {
+		struct juno_voice *voice = voice_reader_update(&juno->reader);
+		if (voice)
+			use_packed_voice(juno, voice->voice);
+	}
+#endif
 }
 
 /*
- * A diphone has three major stages:
- * - nucleus of first phoneme
- * - first half of transition (use sound source of first phoneme)
- * - second half of transition (use sound source of second phoneme)
- *
- * The nucleus is generated from the nucleus sound source of the first phoneme.
+ * Plan and queue the diphone of phoneme indices p1 p2 of the current voice.
+ * The schedule is looked up in the precompiled tables if they were built for
+ * this voice.
  */
-// XXX this function should also take speech modifiers, eg, rate and pitch
-void juno_speak_diphone(struct juno *juno, const Phoneme *p1, const Phoneme *p2)
+static void plan_diphone(struct juno *juno, int p1, int p2)
 {
-	// modulate F0
-
-	unsigned short f0a = juno->modulated_pitch[juno->pitch_phase];
-	if (++juno->pitch_phase >= PITCH_MODULATION_CYCLE)
-		juno->pitch_phase = 0;
-	unsigned short f0b = juno->modulated_pitch[juno->pitch_phase];
-
-	//fprintf(stderr, "%s (%d) p1=%p p2=%p\n", __func__, __LINE__, p1, p2);
-	
-	const PhonemeFlags *flags1 = &phonemeFlags[typeFromPhoneme(p1)];
-	const PhonemeFlags *flags2 = &phonemeFlags[typeFromPhoneme(p2)];
-	//fprintf(stderr, "%s (%d)\n", __func__, __LINE__);
-	if (ndurFromPhonemeFlags(flags1)) {
-#if BIG_TARGET
-		fprintf(stderr, "# -- playing nucleus\n");
-	//fprintf(stderr, "%s (%d)\n", __func__, __LINE__);
+	struct juno_segment segs[DIPHONE_SEGMENTS];
+
+	follow_voice(juno);
+	if (juno->packed)
+		diphone_plan_packed(juno->packed, p1, p2, segs);
+#if DIPHONE_TABLE
+	else if (juno->voice == diphone_table_voice)
+		diphone_lookup(p1, p2, segs);
 #endif
-		FreqSet f = freqSetFromPhoneme(p1);
-		if (f.f[0] != 0)
-			f.f[0] = f0a;
-		juno_speak_segment(juno, &f, &f, ndurFromPhonemeFlags(flags1), nsrcFromPhonemeFlags(flags1));
-	}
-	if (tdurFromPhonemeFlags(flags1) == 0 && tdurFromPhonemeFlags(flags2) == 0) return;
+	else
+		diphone_plan(&juno->voice->phonemes[p1],
+		             &juno->voice->phonemes[p2], segs);
+	queue_diphone(juno, segs);
+}
 
-	// XXX this does not handle aspirated phoneme (this should be aspirated
-	// but take the frequencies of the following sonorant).
-#if 1
-	FreqSet fsets[4]; // 4 endpoints: 2 for post- and 2 for pre-phoneme
-	if (obstruentFromPhonemeFlags(flags1)) {
-#if BIG_TARGET
-		fprintf(stderr, "# %s: p1 is obstruent\n", __func__);
-#endif
-		fsets[0] = obstargetsFromPhoneme(p2, obstypeFromPhoneme(p1));
-	} else {
-#if BIG_TARGET
-		fprintf(stderr, "# %s: p1 is not obstruent\n", __func__);
-#endif
-		fsets[0] = freqSetFromPhoneme(p1);
-	}
-	if (obstruentFromPhonemeFlags(flags2)) {
-#if BIG_TARGET
-		fprintf(stderr, "# %s: p2 is obstruent\n", __func__);
-#endif
-		fsets[3] = obstargetsFromPhoneme(p1, obstypeFromPhoneme(p2));
+void juno_plan_diphone(struct juno *juno, const Phoneme *p1, const Phoneme *p2)
+{
+	follow_voice(juno);
+	const Phoneme *phonemes = juno->voice ? juno->voice->phonemes : NULL;
+	if (phonemes &&
+	    p1 >= phonemes && p1 < phonemes + N_PHONEME &&
+	    p2 >= phonemes && p2 < phonemes + N_PHONEME) {
+		plan_diphone(juno, p1 - phonemes, p2 - phonemes);
 	} else {
-#if BIG_TARGET
-		fprintf(stderr, "# %s: p2 is not obstruent\n", __func__);
-#endif
-		fsets[3] = freqSetFromPhoneme(p2);
+		struct juno_segment segs[DIPHONE_SEGMENTS];
+		diphone_plan(p1, p2, segs);
+		queue_diphone(juno, segs);
 	}
+}
 
-	int i;
-	short dur1 = tdurFromPhonemeFlags(flags1);
-	short dur2 = tdurFromPhonemeFlags(flags2);
-#if BIG_TARGET
-	fprintf(stderr, "# %s: dur1=%d dur2=%d\n", __func__, dur1, dur2);
-#endif
-	if (!glideFromPhonemeFlags(flags1) || !glideFromPhonemeFlags(flags2)) {
-#if BIG_TARGET
-		fprintf(stderr, "# %s: no glide!\n", __func__);
-#endif
-		// easy: stair-step transition
-		fsets[1] = fsets[0];
-		fsets[2] = fsets[3];
-	} else {
-#if BIG_TARGET
-		fprintf(stderr, "# %s: glide!\n", __func__);
-	//fprintf(stderr, "# %s (%d)\n", __func__, __LINE__);
-#endif
-		// harder: compute center point using transition durations of
-		// post and pre
-		for (i = 0; i < 4; ++i) {
-			short f0 = fsets[0].f[i];
-			short f3 = fsets[3].f[i];
-#if BIG_TARGET
-			fprintf(stderr, "# %s: [%d] f0=%d f3=%d\n", __func__, i, f0, f3);
-#endif
-			// f1=f2 = d1/(d1+d2) * (f3-f0) + f0
-			// = (d1 * (f3-f0)) / (d1+d2) + f0
-			fsets[1].f[i] = fsets[2].f[i] = ((long)dur1 * (f3-f0)) /
-			                        ((long)dur1 + dur2) + f0;
-		}
-	}
-	// TODO we want voiced phonemes to play during their post segments even
-	// if the next phoneme is silent or aspirated. as it is now, nothing is
-	// voiced because the next phoneme has formants of 0
-	if (dur1) {
-#if BIG_TARGET
-		fprintf(stderr, "# -- playing post\n");
-#endif
-		//if (fsets[0].f[0] != 0)
-			fsets[0].f[0] = f0a;
-		//if (fsets[1].f[0] != 0)
-			fsets[1].f[0] = f0a;
-		// XXX hack for aspirated consonant
-		if (nsrcFromPhonemeFlags(flags1) == SOURCE_ASPIRATION) {
-			fsets[0].f[1] = fsets[3].f[1];
-			fsets[0].f[2] = fsets[3].f[2];
-			fsets[0].f[3] = fsets[3].f[3];
-		}
-		juno_speak_segment(juno, &fsets[0], &fsets[1], dur1, postsrcFromPhonemeFlags(flags1));
-	}
-	int presrc = presrcFromPhonemeFlags(flags2);
-	if (presrc == SOURCE_ASPIRATION) {
-		// XXX hack!
-		// don't play segment before aspiration
-		dur2 = 0;
-	}
-	if (dur2) {
-#if BIG_TARGET
-		fprintf(stderr, "# -- playing pre\n");
-#endif
-		//if (fsets[2].f[0] != 0)
-			fsets[2].f[0] = f0a;
-		//if (fsets[3].f[0] != 0)
-			fsets[3].f[0] = f0b;
-#if 0
-		if (presrc == SOURCE_ASPIRATION) {
-			// XXX hack
-			// extend previous phoneme
-			//fsets[3].f[0] = fsets[2].f[0];
-			fsets[3].f[1] = fsets[2].f[1];
-			fsets[3].f[2] = fsets[2].f[2];
-			fsets[3].f[3] = fsets[2].f[3];
-			presrc = postsrcFromPhonemeFlags(flags1);
-		}
-#endif
-		juno_speak_segment(juno, &fsets[2], &fsets[3], dur2, presrc);
-	}
-#else
-	//
-	// XXX quick hack without gliding during the transition
-	if (tdurFromPhonemeFlags(flags1)) {
-		juno_speak_segment(juno, &p1->f, &p1->f, tdurFromPhonemeFlags(flags1), postsrcFromPhonemeFlags(flags1));
-	}
-	if (tdurFromPhonemeFlags(flags2)) {
-		juno_speak_segment(juno, &p2->f, &p2->f, tdurFromPhonemeFlags(flags2), presrcFromPhonemeFlags(flags2));
-	}
-#endif
-	// TODO
+void juno_speak_diphone(struct juno *juno, const Phoneme *p1, const Phoneme *p2)
+{
+	juno_plan_diphone(juno, p1, p2);
+	juno_render_segments(juno, -1);
 }
 
 static __flash const int char_phoneme[256] = {
@@ -679,21 +956,17 @@ static int phoneme_from_char(int c)
 
 void juno_speak_phone(struct juno *juno, char c)
 {
-	static int lastp = P_none;
 	int nextp = phoneme_from_char(c);
 
-	const Phoneme *a = (&juno->voice->phonemes[lastp]);
-	const Phoneme *b = (&juno->voice->phonemes[nextp]);
+	plan_diphone(juno, juno->lastp, nextp);
+	juno_render_segments(juno, -1);
 
-	juno_speak_diphone(juno, a, b);
+	juno->lastp = nextp;
 
-	lastp = nextp;
-
-#if BIG_TARGET
-	static int lastc = ' ';
-	fprintf(stderr, "# play diphone /%c%c/\n", lastc, c);
+#if JUNO_TRACE
+	fprintf(stderr, "# play diphone /%c%c/\n", juno->lastc, c);
 	fflush(NULL);
-	lastc = c;
+	juno->lastc = c;
 #endif
 }
 
@@ -708,52 +981,371 @@ void juno_speak_phones(struct juno *juno, const char *phones)
 
 static void default_write_sample(mono8 unused) { /* no-op */ }
 
+// compatibility shim for per-sample output
+static void write_block_by_sample(void *ctx, const mono8 *samples, int n)
+{
+	int i;
+	for (i = 0; i < n; ++i) {
+#if BIG_TARGET
+		struct juno *juno = ctx;
+		juno->write_sample(samples[i]);
+#else
+		audio_play_sample(samples[i]);
+#endif
+	}
+}
+
+size_t juno_size(void)
+{
+	return sizeof (struct juno);
+}
+
 struct juno *juno_create(void)
 {
-	static struct juno juno[JUNO_MAX_OBJECTS];
-	static int next = 0;
+	struct juno *j;
+#if BIG_TARGET
+	j = malloc(sizeof *j);
+	if (!j) return NULL;
+#else
+	static struct juno pool[JUNO_MAX_OBJECTS];
+	int i;
+
+	for (i = 0; i < JUNO_MAX_OBJECTS && pool[i].allocated; ++i)
+		;
+	if (i >= JUNO_MAX_OBJECTS) return NULL;
+	j = &pool[i];
+#endif
+	juno_create_in(j, sizeof *j);
+	j->allocated = true;
+	return j;
+}
 
-	if (next >= JUNO_MAX_OBJECTS) return NULL;
-	
-	struct juno *j = &juno[next++];
+struct juno *juno_create_in(void *mem, size_t size)
+{
+	struct juno *j = mem;
+
+	if (!mem || size < sizeof *j ||
+	    (uintptr_t)mem % __alignof__(struct juno) != 0)
+		return NULL;
+	// everything not set below starts out as zero, including the
+	// oscillator phases
+	memset(j, 0, sizeof *j);
+	j->lastp = P_none;
+	j->pitch_modulation = 100;
+#if JUNO_TRACE
+	j->lastc = ' ';
+#endif
 
 	juno_set_output(j, default_write_sample);
-	juno_set_voice(j, &voiceBob);
+	use_default_voice(j);
+	j->voice_index = 0;
+
+	j->kernels = render_select_kernels();
+
+#if BUZZ_MULTIRATE
+	j->decimation = BUZZ_DECIMATION;
+	j->upsampling = false;
+#if BIG_TARGET
+	const char *rate = getenv("JUNO_BUZZ_RATE");
+	if (rate) {
+		int d = atoi(rate);
+		if ((d == 1 || d == 2 || d == 4) && SUBSLICE_SAMPLES % d == 0)
+			j->decimation = d;
+		else
+			fprintf(stderr, "# JUNO_BUZZ_RATE=%s is not available\n",
+			        rate);
+	}
+#endif
+#endif
 
 	j->pitch_phase = 0;
 
-	// this is an array of ratios (scaled by 256) to pitch modulate
-	// the voice
-	static const unsigned short pitch_modulation[] PROGMEM = {
-		120*256L/120, 128*256L/120, 134*256L/120, 138*256L/120,
-		140*256L/120, 138*256L/120, 134*256L/120, 128*256L/120,
-		120*256L/120, 112*256L/120, 106*256L/120, 102*256L/120,
-		100*256L/120, 102*256L/120, 106*256L/120, 112*256L/120,
+	// TODO initialize juno object
+
+	return j;
+}
+
+void juno_destroy(struct juno *juno)
+{
+	if (!juno)
+		return;
+	detach_voice(juno);
+	if (!juno->allocated)
+		return;
+#if BIG_TARGET
+	free(juno);
+#else
+	juno->allocated = false;
+#endif
+}
+
+void juno_set_output(struct juno *juno, void (*out)(mono8))
+{
+	juno->write_sample = out ?: default_write_sample;
+	juno_set_output_block(juno, write_block_by_sample, juno);
+}
+
+void juno_set_output_block(struct juno *juno, juno_block_fn out, void *ctx)
+{
+	if (!out) {
+		out = write_block_by_sample;
+		ctx = juno;
+	}
+	juno->write_block = out;
+	juno->block_ctx = ctx;
+	// a silence sink belongs to the old ctx
+	juno->write_silence = NULL;
+}
+
+void juno_set_output_silence(struct juno *juno, juno_silence_fn out)
+{
+	juno->write_silence = out;
+}
+
+void juno_get_stats(struct juno const *juno, struct juno_stats *stats)
+{
+	*stats = juno->stats;
+	stats->kernels = juno->kernels->name;
+#if BUZZ_MULTIRATE
+	stats->buzz_decimation = juno->decimation;
+#else
+	stats->buzz_decimation = 1;
+#endif
+}
+
+void juno_set_recorder(struct juno *juno, juno_record_fn rec, void *ctx)
+{
+	juno->record = rec;
+	juno->record_ctx = ctx;
+}
+
+unsigned long juno_pitch_ratio(int pitch)
+{
+	// 2^(n/12) for one octave
+	static const unsigned long semitones[12] PROGMEM = {
+		65536, 69433, 73562, 77936, 82570, 87480,
+		92682, 98193, 104032, 110218, 116772, 123715,
 	};
+	int octave = pitch >= 0 ? pitch / 12 : -((11 - pitch) / 12);
+	unsigned long ratio = pgm_read_long(&semitones[pitch - octave * 12]);
+	return octave >= 0 ? ratio << octave : ratio >> -octave;
+}
+
+/*
+ * Build the tables for the options into the tables not in use, for
+ * queue_diphone to switch to at the next diphone. This is the only place the
+ * options are calculated with, so changing them costs the synthesis nothing.
+ *
+ * The pitch modulation of the voice is scaled towards its pitch by
+ * pitch_modulation percent, then shifted by pitch half-tones. Durations are
+ * scaled by the rate of the voice over rate.
+ *
+ * Options are only set from the thread that plans the diphones (see juno.h),
+ * so the tables and tables_pending need no atomics.
+ */
+static void build_tables(struct juno *juno)
+{
+	struct option_tables *t = &juno->tables[!juno->table];
+	unsigned long ratio = juno_pitch_ratio(juno->pitch);
+	unsigned vrate = juno->voice_rate;
+	unsigned rate = juno->rate ? juno->rate : vrate;
+	int i;
+
+	for (i = 0; i < PITCH_MODULATION_CYCLE; ++i) {
+		long f = juno->voice_f0 + ((long)juno->voice_pitch[i] -
+		         juno->voice_f0) * juno->pitch_modulation / 100;
+		uint64_t f0 = (uint64_t)f * ratio >> 16;
+		t->modulated_pitch[i] = f0 < 0x7fff ? f0 : 0x7fff;
+	}
+	// durations must fit in a byte (see juno_set_rate)
+	if (rate < (vrate + 3) / 4)
+		rate = (vrate + 3) / 4;
+	for (i = 0; i < DURATION_TABLE_SIZE; ++i) {
+		unsigned d = ((unsigned long)i * vrate + rate / 2) / rate;
+		// never drop a segment
+		t->durations[i] = i && !d ? 1 : d;
+	}
+	t->duration_scale = ((unsigned long)vrate * 256 + rate / 2) / rate;
+	juno->tables_pending = true;
+}
 
+static void use_voice(struct juno *juno, Voice const*voice)
+{
+	juno->voice = voice;
+	juno->packed = NULL;
+	memcpy_PF(juno->voice_pitch, voice->modulated_pitch,
+	          sizeof juno->voice_pitch);
+	juno->voice_f0 = pgm_read_unsigned_short(&voice->pitch);
+	juno->voice_rate = pgm_read_unsigned_short(&voice->rate);
+	build_tables(juno);
+}
+
+static void use_packed_voice(struct juno *juno, PackedVoice const*voice)
+{
+	static const unsigned short pitch_modulation[] PROGMEM =
+		PITCH_MODULATION_RATIOS;
+	unsigned long pitch = pgm_read_word(&voice->pitch);
 	int i;
-	unsigned long pitch = pgm_read_unsigned_short(&j->voice->pitch);
+
+	juno->voice = NULL;
+	juno->packed = voice;
+	// (Voices come with this precomputed by voicec)
 	for (i = 0; i < PITCH_MODULATION_CYCLE; ++i) {
-		j->modulated_pitch[i] =
+		juno->voice_pitch[i] =
 			pgm_read_short(&pitch_modulation[i]) * pitch / 256;
+	}
+	juno->voice_f0 = pitch;
+	juno->voice_rate = pgm_read_byte(&voice->rate);
+	build_tables(juno);
+}
+
+static void use_default_voice(struct juno *juno)
+{
+#if PACKED_VOICE
+	use_packed_voice(juno, &packedBob);
+#else
+	use_voice(juno, &voiceBob);
+#endif
+}
+
+// stop following a voice handle
+static void detach_voice(struct juno *juno)
+{
 #if BIG_TARGET
-		fprintf(stderr, "%2d: %hu\n", i, j->modulated_pitch[i]);
+	if (juno->reader.handle)
+		voice_reader_attach(&juno->reader, NULL);
 #endif
+}
+
+void juno_set_voice(struct juno *juno, Voice const*voice)
+{
+	detach_voice(juno);
+	use_voice(juno, voice);
+	juno->voice_index = -1;
+}
+
+void juno_set_packed_voice(struct juno *juno, PackedVoice const*voice)
+{
+	detach_voice(juno);
+	use_packed_voice(juno, voice);
+	juno->voice_index = -1;
+}
+
+bool juno_get_voice(struct juno const *juno, int *voice)
+{
+	*voice = juno->voice_index;
+	return true;
+}
+
+bool juno_set_voice_index(struct juno *juno, int voice)
+{
+	if (voice < 0 || voice >= n_voices)
+		return false;
+	if (voice == juno->voice_index)
+		return true;
+	detach_voice(juno);
+	// voices[0] is the default voice, which is packed on small targets
+	if (voice == 0)
+		use_default_voice(juno);
+	else
+		use_voice(juno, voices[voice]);
+	juno->voice_index = voice;
+	return true;
+}
+
+bool juno_get_pitch(struct juno const *juno, int *pitch)
+{
+	*pitch = juno->pitch;
+	return true;
+}
+
+bool juno_set_pitch(struct juno *juno, int pitch)
+{
+	if (pitch < -JUNO_PITCH_RANGE || pitch > JUNO_PITCH_RANGE)
+		return false;
+	if (pitch != juno->pitch) {
+		juno->pitch = pitch;
+		build_tables(juno);
 	}
+	return true;
+}
 
-	// TODO initialize juno object
+bool juno_get_pitch_modulation(struct juno const *juno, int *pitch)
+{
+	*pitch = juno->pitch_modulation;
+	return true;
+}
 
-	return j;
+bool juno_set_pitch_modulation(struct juno *juno, int pitch)
+{
+	if (pitch < 0 || pitch > 100)
+		return false;
+	if (pitch != juno->pitch_modulation) {
+		juno->pitch_modulation = pitch;
+		build_tables(juno);
+	}
+	return true;
 }
 
-void juno_set_output(struct juno *juno, void (*out)(mono8))
+bool juno_get_rate(struct juno const *juno, int *rate)
 {
-	juno->write_sample = out ?: default_write_sample;
+	*rate = juno->rate ? juno->rate : juno->voice_rate;
+	return true;
 }
 
-void juno_set_voice(struct juno *juno, Voice const*voice)
+bool juno_set_rate(struct juno *juno, int rate)
 {
-	juno->voice = voice;
-	// TODO modulate pitch here
+	// at a quarter of the rate of the voice, the longest duration in the
+	// table just fits in a byte
+	if (rate != 0 &&
+	    (rate < (juno->voice_rate + 3) / 4 || rate > JUNO_RATE_MAX))
+		return false;
+	if (rate != juno->rate) {
+		juno->rate = rate;
+		build_tables(juno);
+	}
+	return true;
+}
+
+bool juno_getoptions(struct juno const *juno, struct juno_options *opts)
+{
+	// the rate option rather than juno_get_rate, so that 0 keeps following
+	// the voice when these options are set again
+	opts->rate = juno->rate;
+	return juno_get_voice(juno, &opts->voice) &&
+	       juno_get_pitch(juno, &opts->pitch) &&
+	       juno_get_pitch_modulation(juno, &opts->pitch_modulation);
+}
+
+bool juno_setoptions(struct juno *juno, struct juno_options const *opts,
+                     struct juno_options *old)
+{
+	bool ret = true;
+
+	if (old)
+		ret &= juno_getoptions(juno, old);
+	if (opts) {
+		// the voice first, as the rate is checked against it
+		if (opts->voice != juno->voice_index)
+			ret &= juno_set_voice_index(juno, opts->voice);
+		ret &= juno_set_pitch(juno, opts->pitch);
+		ret &= juno_set_pitch_modulation(juno, opts->pitch_modulation);
+		ret &= juno_set_rate(juno, opts->rate);
+	}
+	return ret;
+}
+
+#if BIG_TARGET
+void juno_attach_voice(struct juno *juno, struct juno_voice_handle *handle)
+{
+	struct juno_voice *voice = voice_reader_attach(&juno->reader, handle);
+	if (voice) {
+		use_packed_voice(juno, voice->voice);
+		juno->voice_index = -1;
+	} else {
+		use_default_voice(juno);
+		juno->voice_index = 0;
+	}
 }
+#endif
 
@@ -2,8 +2,11 @@
 #define _JUNO_H_
 
 #include <stdbool.h>
+#include <stddef.h>
 
-#ifdef unix
+// unix is a GNU extension; strict ISO modes (eg -std=c++20) only define
+// __unix__
+#if defined(unix) || defined(__unix__)
 # define BIG_TARGET 1
 #else
 # define BIG_TARGET 0
@@ -18,6 +21,12 @@
  * External interface for the Juno speech synthesizer
  */
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// number of juno objects that juno_create can hand out on small targets
+// (big targets allocate them with malloc)
 #ifndef JUNO_MAX_OBJECTS
 #define JUNO_MAX_OBJECTS 1
 #endif
@@ -32,7 +41,20 @@ struct juno;
 };
 #endif
 
+/*
+ * Create and destroy juno objects. Every object has its own oscillators and
+ * output, so any number of them can speak at once, each from one thread at a
+ * time.
+ *
+ * juno_create_in creates an object in size bytes of memory supplied by the
+ * caller (eg, from an allocator, or a static buffer), which must be at least
+ * juno_size() bytes and aligned for any type. It returns NULL if it is not.
+ * juno_destroy does nothing with that memory, which stays the caller's.
+ */
 struct juno *juno_create(void);
+size_t juno_size(void);
+struct juno *juno_create_in(void *mem, size_t size);
+void juno_destroy(struct juno *juno);
 
 #if 0
 /*
@@ -52,44 +74,99 @@ void juno_speak_phones(struct juno *juno, const char *);
 void juno_speak_english(struct juno *juno, const char *);
 
 // XXX this shouldn't be public but for testing
+// with FREQ_DDA, segments of up to 8191 steps (nslices * FREQ_SUBSLICES) get
+// their slopes without division; longer ones are divided, which is slow on
+// targets without a hardware divider
 void juno_speak_segment(struct juno *juno,
                 const FreqSet *start, const FreqSet *end,
                 int nslices, SoundSource source);
 
+/*
+ * Segments
+ *
+ * Speaking is split into two stages. The frontend (juno_plan_diphone) turns
+ * diphones into segments and appends them to a queue in the juno object; the
+ * backend (juno_render_segments) takes segments off the queue and renders
+ * them. juno_speak_diphone does both, so segments are rendered as soon as
+ * each diphone is planned.
+ *
+ * Calling the stages separately allows looking ahead at the queued segments
+ * and timing the frontend and backend separately. If the queue fills up,
+ * juno_plan_diphone renders the oldest segments to make room.
+ */
+struct juno_segment {
+	FreqSet start, end;
+	short nslices;
+	uint8_t source; // SoundSource
+};
+
+void juno_plan_diphone(struct juno *juno, const Phoneme *p1, const Phoneme *p2);
+void juno_queue_segment(struct juno *juno, const struct juno_segment *seg);
+// render up to max queued segments (all of them if max is negative)
+// return the number of segments rendered
+int juno_render_segments(struct juno *juno, int max);
+// return the number of queued segments, and look at the ith one (0 is the
+// next one to be rendered)
+int juno_queued_segments(struct juno const *juno);
+const struct juno_segment *juno_peek_segment(struct juno const *juno, int i);
+
 /*
  * Juno options
+ *
+ * Options can be changed at any time, including between the diphones of an
+ * utterance. Setting one builds the pitch modulation and duration tables for
+ * the new options, and the next diphone planned switches to them; segments
+ * already queued keep the old options.
+ *
+ * The tables are handed over without locks or atomics, so options must be
+ * set from the thread that speaks with the juno object (eg, from a sink or
+ * between calls to juno_speak_phone), like every other call on it. To change
+ * the voice from another thread, attach the object to a voice handle (see
+ * juno_attach_voice in voicefile.h).
  */
 struct juno_options {
 	// which voice (probably only one voice will be supported on most
 	// targets)
+	// index into voices[], or -1 for a voice set some other way
 	int voice;
 	// pitch (adjusts the base frequency of the voice)
-	// measured in half-tones in the same scale as MIDI
+	// measured in half-tones in the same scale as MIDI, relative to the
+	// pitch of the voice, up to JUNO_PITCH_RANGE either way
 	int pitch;
 	// pitch modulation (adjusts the maximum deviation of pitch)
 	// measured as percentage 0%..100%
 	int pitch_modulation;
 	// playback rate (adjusts the base playback rate)
-	// measured in (approximate) words per minute
+	// measured in (approximate) words per minute, from a quarter of the
+	// rate of the voice to JUNO_RATE_MAX
+	// 0 follows the rate of the voice (juno_get_rate gives the rate in
+	// effect)
 	int rate;
 };
 
+#define JUNO_PITCH_RANGE 24
+#define JUNO_RATE_MAX 1000
+
 /*
  * Get/set all options.
  */
-bool juno_getoptions(struct juno const *juno, struct juno_options *new);
+bool juno_getoptions(struct juno const *juno, struct juno_options *opts);
 // attempt to set all options
 // return false if any options could not be set
-bool juno_setoptions(struct juno *juno, struct juno_options const *new, struct juno_options *old);
+bool juno_setoptions(struct juno *juno, struct juno_options const *opts, struct juno_options *old);
 
 /*
  * Get/set options individually.
  */
 
 // XXX argument types may need to be changed
-//bool juno_get_voice(struct juno const *juno, int *voice);
-//bool juno_set_voice(struct juno *juno, int voice);
+bool juno_get_voice(struct juno const *juno, int *voice);
+// speak with voices[voice]
+bool juno_set_voice_index(struct juno *juno, int voice);
 void juno_set_voice(struct juno *juno, Voice const*voice);
+// speak with a packed voice (see packed.h)
+struct packed_voice;
+void juno_set_packed_voice(struct juno *juno, struct packed_voice const*voice);
 
 bool juno_get_pitch(struct juno const *juno, int *pitch);
 bool juno_set_pitch(struct juno *juno, int pitch);
@@ -97,11 +174,73 @@ bool juno_set_pitch(struct juno *juno, int pitch);
 bool juno_get_pitch_modulation(struct juno const *juno, int *pitch);
 bool juno_set_pitch_modulation(struct juno *juno, int pitch);
 
+// the rate in effect: the rate of the voice if the rate option is 0
 bool juno_get_rate(struct juno const *juno, int *rate);
 bool juno_set_rate(struct juno *juno, int rate);
 
+// 2^(pitch/12) in 16.16 fixed point (the pitch ratio of pitch half-tones)
+// pitch must be within JUNO_PITCH_RANGE either way
+unsigned long juno_pitch_ratio(int pitch);
+
 void juno_set_output(struct juno *juno, void (*out)(mono8 sample));
 
+/*
+ * Set a block output sink. Rather than calling a function for every sample,
+ * Juno renders a timeslice (SLICE_SAMPLES samples) into a buffer and hands the
+ * whole buffer to out() at once. Segments that don't change are handed over
+ * in blocks of up to BLOCK_SAMPLES samples. The buffer is only valid during
+ * the call.
+ * ctx is passed through to out() unchanged.
+ *
+ * juno_set_output() is implemented on top of this.
+ */
+typedef void (*juno_block_fn)(void *ctx, const mono8 *samples, int nsamples);
+void juno_set_output_block(struct juno *juno, juno_block_fn out, void *ctx);
+
+/*
+ * Set a silence sink. Silent segments (word gaps, stop closures, and the
+ * trailing pause after every utterance) are then reported to out() as a
+ * single run of nsamples zero samples instead of being rendered and handed to
+ * the block sink, so a file or network consumer can skip or compress them.
+ * out() gets the same ctx as the block sink.
+ *
+ * Without a silence sink (the default, and after every call to
+ * juno_set_output_block()), silence is written to the block sink as ordinary
+ * blocks of zeros.
+ */
+typedef void (*juno_silence_fn)(void *ctx, long nsamples);
+void juno_set_output_silence(struct juno *juno, juno_silence_fn out);
+
+/*
+ * Set a recorder. As juno_speak_segment renders, it reports the source and
+ * frequencies of every timeslice to rec(), with nslices > 1 for a run of
+ * identical timeslices (steady segments and silence). freqs is all zeros for
+ * silence. With FREQ_SUBSLICES > 1, only the first step of every timeslice is
+ * reported. This is what track.h records. Pass NULL to stop recording.
+ */
+typedef void (*juno_record_fn)(void *ctx, SoundSource source,
+                               const FreqSet *freqs, int nslices);
+void juno_set_recorder(struct juno *juno, juno_record_fn rec, void *ctx);
+
+/*
+ * Rendering statistics: the number of frequency steps rendered
+ * (FREQ_SUBSLICES per timeslice, not counting silence) and how many of them
+ * needed a new envelope (see SLICE_TOLERANCE_HZ), and how the object renders:
+ * the name of its render kernels (eg, "scalar") and the decimation of its
+ * buzz (see BUZZ_DECIMATION; 1 is the full sample rate).
+ */
+struct juno_stats {
+	unsigned long steps;
+	unsigned long envelopes;
+	const char *kernels;
+	int buzz_decimation;
+};
+void juno_get_stats(struct juno const *juno, struct juno_stats *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
 #if defined(__AVR_ATmega328P__)
 # include <avr/io.h>
 # include <avr/interrupt.h>
@@ -145,6 +284,115 @@ void juno_set_output(struct juno *juno, void (*out)(mono8 sample));
 
 #define SLICES_PER_SECOND 250
 
+// number of samples in a slice
+#define SLICE_SAMPLES (SAMPLE_RATE/SLICES_PER_SECOND)
+
+// number of slices that are rendered into one output block when a segment
+// does not change (steady-state nuclei and silence)
+// larger blocks mean fewer kernel and sink calls but more RAM
+#ifndef BLOCK_SLICES
+# if BIG_TARGET
+#  define BLOCK_SLICES 16
+# else
+#  define BLOCK_SLICES 1
+# endif
+#endif
+#define BLOCK_SAMPLES (BLOCK_SLICES * SLICE_SAMPLES)
+
+// interpolate frequencies within a segment in 16.16 fixed point, with slopes
+// calculated without division (see juno_speak_segment)
+// otherwise slopes are whole accumulator units per step, truncated
+#ifndef FREQ_DDA
+# define FREQ_DDA 1
+#endif
+
+// number of times the frequencies are updated in each timeslice
+// SLICES_PER_SECOND can be lowered for throughput (fewer, longer kernel
+// calls) while raising this to keep frequency glides smooth
+// this must divide SLICE_SAMPLES
+#ifndef FREQ_SUBSLICES
+# define FREQ_SUBSLICES 1
+#endif
+#define SUBSLICE_SAMPLES (SLICE_SAMPLES / FREQ_SUBSLICES)
+
+// keep rendering with the same envelope until a frequency has moved more
+// than this many Hz (0 recalculates it whenever any frequency changes)
+#ifndef SLICE_TOLERANCE_HZ
+# define SLICE_TOLERANCE_HZ 0
+#endif
+#define SLICE_TOLERANCE ((long)FREQ(SLICE_TOLERANCE_HZ))
+
+// render buzz (voiced segments) at 1/BUZZ_DECIMATION of the sample rate, and
+// interpolate it back up to the full rate with half-band filters (see
+// render_upsample2); frication needs the whole band and is always rendered at
+// the full rate
+// 1 renders everything at the full rate; otherwise this is 2 or 4 and must
+// divide SUBSLICE_SAMPLES
+// on big targets, the JUNO_BUZZ_RATE environment variable (1, 2, or 4)
+// overrides this to compare the two
+#ifndef BUZZ_DECIMATION
+# define BUZZ_DECIMATION 1
+#endif
+
+// number of segments that can be queued between planning and rendering
+// (a diphone makes up to 3 segments)
+// this must be a power of 2
+#ifndef SEGMENT_QUEUE_SIZE
+# if BIG_TARGET
+#  define SEGMENT_QUEUE_SIZE 16
+# else
+#  define SEGMENT_QUEUE_SIZE 4
+# endif
+#endif
+
+// look up diphone schedules in tables precompiled by build-schedule (see
+// diphone.h) rather than planning them from the phoneme data
+// the tables take about 22KB, which is too much for small targets
+#ifndef DIPHONE_TABLE
+# define DIPHONE_TABLE BIG_TARGET
+#endif
+
+// speak with the packed copy of the default voice (see packed.h), which takes
+// about a third of the flash of the Voice but rounds its frequencies to within
+// 1.6%
+#ifndef PACKED_VOICE
+# if BIG_TARGET
+#  define PACKED_VOICE 0
+# else
+#  define PACKED_VOICE 1
+# endif
+#endif
+
+// durations of up to this many timeslices are scaled to the rate (see
+// juno_set_rate) by table lookup, and longer ones by multiplication
+#ifndef DURATION_TABLE_SIZE
+# if BIG_TARGET
+#  define DURATION_TABLE_SIZE 64
+# else
+#  define DURATION_TABLE_SIZE 32
+# endif
+#endif
+
+// calculate the envelope with a table of reciprocals instead of dividing by
+// f0 (see calc_envelope)
+// this is for targets without a hardware divider
+#ifndef ENVELOPE_RECIP
+# if BIG_TARGET
+#  define ENVELOPE_RECIP 0
+# else
+#  define ENVELOPE_RECIP 1
+# endif
+#endif
+
+// print every diphone and segment to stderr as it is spoken (big targets
+// only)
+#ifndef JUNO_TRACE
+# define JUNO_TRACE 0
+#endif
+#if JUNO_TRACE && !BIG_TARGET
+# error JUNO_TRACE needs a big target
+#endif
+
 // convert duration in milliseconds to samples
 // these are to be used only for compile-time constants!
 #define DUR(ms)  ((double)(ms) * SLICES_PER_SECOND / 1000)
@@ -0,0 +1,98 @@
+#ifndef _JUNO_HPP_
+#define _JUNO_HPP_
+
+/*
+ * C++ interface for the Juno speech synthesizer (C++20, big targets only)
+ *
+ * juno_session owns a juno object: it is created with the session and
+ * destroyed with it. Sessions can be moved but not copied.
+ *
+ * set_sink() takes any callable that accepts a std::span<const mono8>, and
+ * installs it as the block sink (see juno_set_output_block) through a
+ * trampoline made for its type, so the sink is called directly, once per
+ * block, rather than through a pointer once per sample. The session keeps a
+ * pointer to the sink, which must outlive it (or the next set_sink).
+ *
+ *	std::vector<mono8> pcm;
+ *	auto sink = [&](std::span<const mono8> s) {
+ *		pcm.insert(pcm.end(), s.begin(), s.end());
+ *	};
+ *	juno_session s;
+ *	s.set_sink(sink);
+ *	s.speak_phones("hElOU w3ld");
+ *
+ * Anything not wrapped can be done with the C interface on get().
+ */
+
+#include <new>
+#include <span>
+#include <utility>
+
+#include "juno.h"
+
+#if !BIG_TARGET
+# error juno.hpp needs a big target
+#endif
+
+class juno_session {
+public:
+	// throws std::bad_alloc if juno_create fails
+	juno_session() : j(juno_create())
+	{
+		if (!j)
+			throw std::bad_alloc();
+	}
+	~juno_session() { juno_destroy(j); }
+
+	juno_session(juno_session &&other) noexcept
+	  : j(std::exchange(other.j, nullptr)) {}
+	juno_session &operator=(juno_session &&other) noexcept
+	{
+		if (this != &other) {
+			juno_destroy(j);
+			j = std::exchange(other.j, nullptr);
+		}
+		return *this;
+	}
+	juno_session(const juno_session &) = delete;
+	juno_session &operator=(const juno_session &) = delete;
+
+	struct juno *get() const { return j; }
+
+	template <class Sink>
+	void set_sink(Sink &sink)
+	{
+		juno_set_output_block(j,
+		  [](void *ctx, const mono8 *samples, int nsamples) {
+			(*static_cast<Sink *>(ctx))(
+			  std::span<const mono8>(samples, nsamples));
+		  }, &sink);
+	}
+
+	void speak_phones(const char *phones) { juno_speak_phones(j, phones); }
+
+	bool set_options(const juno_options &opts)
+	{
+		return juno_setoptions(j, &opts, nullptr);
+	}
+	juno_options options() const
+	{
+		juno_options opts;
+		juno_getoptions(j, &opts);
+		return opts;
+	}
+	bool set_pitch(int pitch) { return juno_set_pitch(j, pitch); }
+	bool set_rate(int rate) { return juno_set_rate(j, rate); }
+
+	juno_stats stats() const
+	{
+		juno_stats stats;
+		juno_get_stats(j, &stats);
+		return stats;
+	}
+
+private:
+	struct juno *j;
+};
+
+#endif
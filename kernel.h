@@ -0,0 +1,231 @@
+#ifndef _KERNEL_H_
+#define _KERNEL_H_
+
+#include <stdint.h>
+
+#include "juno.h"
+#include "oscillator.h"
+#include "wave.h"
+
+// shift phase accumulator right LOG2_PHASE_MODULUS-LOG2_*_WAVETABLE_PERIOD bits
+// mask lowest LOG2_*_WAVETABLE_SIZE bits
+// where * is BUZZ or FRIC
+
+// scale sample x of buzz oscillator j by its gain
+// oscillator 0 is the glottal buzz and is never scaled
+#if BUZZ_MULTIPLY
+#define SCALE_OSC(j, x) ((j) == 0 ? (x) : ((x) * gain[j] + 128) >> 8)
+#else
+#define SCALE_OSC(j, x) (x)
+#endif
+
+#define ADDOSC(j) do { \
+	phase[j] += freq[j]; \
+	phase[j] &= 0xffff; \
+	/* \
+	 * shift and mask phase to get upper bits which is used \
+	 * as the position in the waveform table \
+	 */ \
+	pos = (phase[j] >> (LOG2_PHASE_MODULUS-LOG2_BUZZ_WAVETABLE_PERIOD)) & (BUZZ_WAVETABLE_SIZE-1); \
+	/*fprintf(stderr, "%5d %d: sample=%d\n", i, j, wave[j]->samples[pos]); */\
+	s += SCALE_OSC(j, pgm_read_mono8(&wave[j]->samples[pos])); \
+} while (0)
+
+#if FRIC_NOISE_LFSR
+static const mono8 noise_carrier[FRIC_WAVETABLE_PERIOD] PROGMEM = {
+	0, 90, 127, 90, 0, -90, -127, -90,
+};
+
+// step a 16-bit xorshift generator and return a random amplitude in -8..7
+static inline int8_t noise_next(uint16_t *lfsr)
+{
+	uint16_t x = *lfsr;
+	x ^= x << 7;
+	x ^= x >> 9;
+	x ^= x << 8;
+	*lfsr = x;
+	return (int8_t)x >> 4;
+}
+
+// advance a frication oscillator and evaluate to its next sample
+#define FRIC_NEXT(phase, freq, noise, lfsr) ({ \
+	(phase) += (freq); \
+	if ((phase) >> LOG2_PHASE_MODULUS) { \
+		/* new cycle: pick a new amplitude */ \
+		(phase) &= 0xffff; \
+		(noise) = ((noise) + noise_next(&(lfsr))) >> 1; \
+	} \
+	(int)pgm_read_mono8(&noise_carrier[(phase) >> \
+	  (LOG2_PHASE_MODULUS-LOG2_FRIC_WAVETABLE_PERIOD)]) * (noise) >> 7; \
+})
+#else
+#define FRIC_NEXT(phase, freq, noise, lfsr) ({ \
+	(phase) += (freq); \
+	/* \
+	 * shift and mask phase to get upper bits which is used \
+	 * as the position in the waveform table \
+	 */ \
+	pgm_read_mono8(&frication_wavetable.samples[ \
+	  ((phase) >> (LOG2_PHASE_MODULUS-LOG2_FRIC_WAVETABLE_PERIOD)) & \
+	  (FRIC_WAVETABLE_SIZE-1)]); \
+})
+#endif
+
+#define ADDFRIC(j) do { \
+	s += FRIC_NEXT(phase[j], freq[j], noise[j], lfsr[j]); \
+} while (0)
+
+#define AMPMOD_ADDOSC(j) do { \
+	phase[j] += freq[j]; \
+	/* \
+	 * shift and mask phase to get upper bits which is used \
+	 * as the position in the waveform table \
+	 */ \
+	pos = (phase[j] >> (LOG2_PHASE_MODULUS-LOG2_BUZZ_WAVETABLE_PERIOD)) & (BUZZ_WAVETABLE_SIZE-1); \
+	/* XXX multiplication by 4 is a hack. fix build-wave.c instead! */ \
+	mod = 1*(int)pgm_read_mono8(&frication_buzz.samples[pos]) + 128; \
+	s = (s * mod / 256) + pgm_read_mono8(&vowel_buzz.samples[pos]); \
+} while (0)
+
+static inline const wavetable_t *wavetable_from_index(uint8_t w)
+{
+	return pgm_read_ptr(&buzz_wavetables[w]);
+}
+
+#endif
+
+/*
+ * Render kernel template
+ *
+ * Including this file generates scalar render kernels specialized for one
+ * output sink. The sink and the oscillator counts are known at compile time,
+ * so the compiler can unroll the oscillator loops and inline the sink into the
+ * sample loop instead of calling through a function pointer. Before including
+ * this file, define:
+ *
+ * KERNEL_NAME(name)  name to give each kernel (eg, name##_scalar)
+ * KERNEL_SINK(s)     consumes one mono8 sample s
+ * KERNEL_SINK_ARGS   extra kernel parameters used by KERNEL_SINK, with a
+ *                    leading comma (optional)
+ * KERNEL_FORMANTS    number of buzz oscillators to render (optional, default
+ *                    N_FORMANTS_FLATOSC)
+ * KERNEL_FRICATIVES  number of frication oscillators to render, not counting
+ *                    the voice bar (optional, default N_FRICATIVE_FLATOSC)
+ *
+ * This defines the static inline functions KERNEL_NAME(formants),
+ * KERNEL_NAME(fricative), and KERNEL_NAME(silence), which take the same
+ * arguments as render_formants, render_fricative, and render_silence minus
+ * the buffer, plus KERNEL_SINK_ARGS. The parameters are undefined again at the
+ * end so this file can be included more than once.
+ *
+ * This is internal to the renderer: render.c instantiates the scalar kernels
+ * with a buffer sink, and juno.c drives them through struct render_kernels.
+ * The kernels only render oscillator banks; setting up the banks for each run
+ * (calc_envelope, calc_frication) stays in juno.c, so including this file is
+ * not a way to get Juno's output into another sink. Use a block sink (see
+ * juno_set_output_block, or set_sink in juno.hpp from C++) for that.
+ */
+
+#ifndef KERNEL_NAME
+#error KERNEL_NAME must be defined before including kernel.h
+#endif
+#ifndef KERNEL_SINK
+#error KERNEL_SINK must be defined before including kernel.h
+#endif
+#ifndef KERNEL_SINK_ARGS
+#define KERNEL_SINK_ARGS
+#endif
+#ifndef KERNEL_FORMANTS
+#define KERNEL_FORMANTS N_FORMANTS_FLATOSC
+#endif
+#ifndef KERNEL_FRICATIVES
+#define KERNEL_FRICATIVES N_FRICATIVE_FLATOSC
+#endif
+
+// the oscillator state is copied to locals so the compiler can keep it in
+// registers (stores by the sink may alias anything)
+
+static inline void KERNEL_NAME(formants)(oscillator_bank *const bank,
+                                         int nsamp KERNEL_SINK_ARGS)
+{
+	int i, j;
+	unsigned pos;
+	unsigned short freq[KERNEL_FORMANTS], phase[KERNEL_FORMANTS];
+	const wavetable_t *wave[KERNEL_FORMANTS];
+#if BUZZ_MULTIPLY
+	uint8_t gain[KERNEL_FORMANTS];
+#endif
+	for (j = 0; j < KERNEL_FORMANTS; ++j) {
+		freq[j] = bank->freq[j];
+		phase[j] = bank->phase[j];
+		wave[j] = wavetable_from_index(bank->wave[j]);
+#if BUZZ_MULTIPLY
+		gain[j] = bank->gain[j];
+#endif
+	}
+	for (i = 0; i < nsamp; ++i) {
+		int s = 0;
+		for (j = 0; j < KERNEL_FORMANTS; ++j) {
+			ADDOSC(j);
+		}
+		KERNEL_SINK(s);
+	}
+	for (j = 0; j < KERNEL_FORMANTS; ++j)
+		bank->phase[j] = phase[j];
+}
+
+// We use only one frication wavetable and one frication buzz wavetable. The
+// frication wavetable is fairly large (larger than the buzz and sine
+// wavetables) to minimize its periodicity. With FRIC_NOISE_LFSR the noise is
+// generated instead (see FRIC_NEXT).
+static inline void KERNEL_NAME(fricative)(fric_oscillator_bank *const bank,
+                                          int nsamp KERNEL_SINK_ARGS)
+{
+	int i, j;
+	unsigned pos;
+	int mod;
+	unsigned short freq[N_FRICATIVE_OSC];
+	uint32_t phase[N_FRICATIVE_OSC];
+#if FRIC_NOISE_LFSR
+	int8_t noise[N_FRICATIVE_FLATOSC];
+	uint16_t lfsr[N_FRICATIVE_FLATOSC];
+	for (j = 0; j < N_FRICATIVE_FLATOSC; ++j) {
+		noise[j] = bank->noise[j];
+		lfsr[j] = bank->lfsr[j];
+	}
+#endif
+	for (j = 0; j < N_FRICATIVE_OSC; ++j) {
+		freq[j] = bank->freq[j];
+		phase[j] = bank->phase[j];
+	}
+	for (i = 0; i < nsamp; ++i) {
+		int s = 0;
+		for (j = 0; j < KERNEL_FRICATIVES; ++j) {
+			ADDFRIC(j);
+		}
+		AMPMOD_ADDOSC(N_FRICATIVE_FLATOSC);
+		KERNEL_SINK(s);
+	}
+	for (j = 0; j < N_FRICATIVE_OSC; ++j)
+		bank->phase[j] = phase[j];
+#if FRIC_NOISE_LFSR
+	for (j = 0; j < N_FRICATIVE_FLATOSC; ++j) {
+		bank->noise[j] = noise[j];
+		bank->lfsr[j] = lfsr[j];
+	}
+#endif
+}
+
+static inline void KERNEL_NAME(silence)(int nsamp KERNEL_SINK_ARGS)
+{
+	int i;
+	for (i = 0; i < nsamp; ++i) {
+		KERNEL_SINK(0);
+	}
+}
+
+#undef KERNEL_NAME
+#undef KERNEL_SINK
+#undef KERNEL_SINK_ARGS
+#undef KERNEL_FORMANTS
+#undef KERNEL_FRICATIVES
@@ -1,8 +0,0 @@
-#ifndef _OPTIONS_H_
-#define _OPTIONS_H_
-
-#include "juno.h"
-
-extern struct juno_options options;
-
-#endif
@@ -1,17 +1,47 @@
 #ifndef _OSCILLATOR_H_
 #define _OSCILLATOR_H_
 
+#include <stdint.h>
+
+#include "formant.h"
 #include "wave.h"
 
+// buzz oscillators: the fundamental plus a harmonic below and above each
+// formant
+#define N_FORMANTS_FLATOSC (2*(N_FREQ-1)+1)
+// frication oscillators: one for each formant plus the voice bar, which is
+// the last oscillator
+#define N_FRICATIVE_FLATOSC (N_FREQ-1)
+#define N_FRICATIVE_OSC (N_FRICATIVE_FLATOSC+1)
+
+/*
+ * Oscillator banks are kept as a struct of arrays so the render kernels can
+ * load all frequencies or all phases at once. Waveforms are indices into
+ * buzz_wavetables[] (see wave.h) rather than pointers, so they cost one byte
+ * per oscillator. In multiply mode (see BUZZ_MULTIPLY in wave.h), gain holds
+ * the amplitude of each harmonic; gain[0] is unused because the glottal buzz
+ * is not scaled.
+ */
 typedef struct {
-	unsigned short freq;
-	unsigned short phase;
-	const wavetable_t *waveform;
-} oscillator;
+	unsigned short freq[N_FORMANTS_FLATOSC];
+	unsigned short phase[N_FORMANTS_FLATOSC];
+	uint8_t wave[N_FORMANTS_FLATOSC];
+#if BUZZ_MULTIPLY
+	uint8_t gain[N_FORMANTS_FLATOSC];
+#endif
+} oscillator_bank;
 
+/*
+ * With FRIC_NOISE_LFSR (see wave.h), each frication oscillator also has the
+ * current amplitude of its noise and the state of its noise generator.
+ */
 typedef struct {
-	unsigned short freq;
-	unsigned long phase;
-} fric_oscillator;
+	unsigned short freq[N_FRICATIVE_OSC];
+	uint32_t phase[N_FRICATIVE_OSC];
+#if FRIC_NOISE_LFSR
+	int8_t noise[N_FRICATIVE_FLATOSC];
+	uint16_t lfsr[N_FRICATIVE_FLATOSC];
+#endif
+} fric_oscillator_bank;
 
 #endif
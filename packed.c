@@ -0,0 +1,68 @@
+#include <stdlib.h>
+
+#include "juno.h"
+#include "packed.h"
+
+uint8_t voice_freq_encode(unsigned short f)
+{
+	// nonzero frequencies never encode to 0, which means no frequency
+	unsigned best = 0;
+	long besterr = f;
+	unsigned code;
+	for (code = 1; code < 256 && f != 0; ++code) {
+		long err = labs((long)voice_freq_decode(code) - f);
+		if (best == 0 || err < besterr) {
+			best = code;
+			besterr = err;
+		}
+	}
+	return best;
+}
+
+void voice_pack(PackedVoice *pv, const Voice *v, const PhonemeFlags *flags)
+{
+	int p, i, t;
+
+	pv->pitch = v->pitch;
+	pv->rate = v->rate;
+	pv->reserved = 0;
+	for (t = 0; t < PHONEME_TYPE_COUNT; ++t) {
+		const PhonemeFlags *f = &flags[t];
+		PackedPhonemeFlags *pf = &pv->flags[t];
+		pf->bits = (f->glide ? PACKED_GLIDE : 0) |
+		           (f->obstruent ? PACKED_OBSTRUENT : 0) |
+		           f->buzz << PACKED_BUZZ_SHIFT;
+		pf->sources = f->presrc << PACKED_PRESRC_SHIFT |
+		              f->nsrc << PACKED_NSRC_SHIFT |
+		              f->postsrc << PACKED_POSTSRC_SHIFT;
+		pf->ndur = f->ndur;
+		pf->tdur = f->tdur;
+	}
+	for (p = 0; p < N_PHONEME; ++p) {
+		const Phoneme *ph = &v->phonemes[p];
+		pv->type[p] = ph->type |
+		              ph->obstype << PACKED_OBSTYPE_SHIFT |
+		              (ph->f.f[0] ? PACKED_VOICED : 0);
+		for (i = 1; i < N_FREQ; ++i) {
+			pv->f[i-1][p] = voice_freq_encode(ph->f.f[i]);
+			for (t = 0; t < N_OBS; ++t)
+				pv->obstargets[t][i-1][p] =
+				  voice_freq_encode(ph->obstargets[t].f[i]);
+		}
+	}
+}
+
+bool voice_packed_check(const PackedVoice *v)
+{
+	int p;
+	// the pitch and rate options are relative to these
+	if (v->pitch == 0 || v->rate == 0)
+		return false;
+	for (p = 0; p < N_PHONEME; ++p) {
+		uint8_t type = v->type[p];
+		if ((type & PACKED_TYPE_MASK) >= PHONEME_TYPE_COUNT ||
+		    (type & PACKED_OBSTYPE_MASK) >> PACKED_OBSTYPE_SHIFT >= N_OBS)
+			return false;
+	}
+	return true;
+}
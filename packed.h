@@ -0,0 +1,143 @@
+#ifndef _PACKED_H_
+#define _PACKED_H_
+
+#include <stdint.h>
+
+#include "juno.h"
+#include "phonemes.h"
+#include "voice.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Packed voices
+ *
+ * A packed voice holds the same data as a Voice plus the phoneme flags
+ * (phonemeFlags) in about a third of the space:
+ *
+ * - Frequencies are 8-bit log-scaled codes (see voice_freq_decode).
+ * - The F0 of phonemes and of obstruent targets is always replaced by the
+ *   pitch of the voice, so it is not stored; only whether a phoneme is
+ *   voiced is kept, in PACKED_VOICED.
+ * - The type, obstruent type, and voicing of a phoneme share a byte.
+ * - The flags of each phoneme type are part of the voice, in 4 bytes.
+ * - Frequencies are stored by formant (a struct of arrays), so a formant of
+ *   every phoneme takes N_PHONEME consecutive bytes.
+ *
+ * Packed voices are built from Voices by build-voice, once for each sample
+ * rate like the Voices themselves (see bobpacked.c). The voice_packed_*
+ * accessors decode one field at a time and read the voice from program memory
+ * on AVR.
+ */
+#define PACKED_TYPE_MASK 0x0f // PhonemeType
+#define PACKED_OBSTYPE_SHIFT 4 // ObsType
+#define PACKED_OBSTYPE_MASK 0x30
+#define PACKED_VOICED 0x80 // F0 is not 0
+
+// PackedPhonemeFlags.bits
+#define PACKED_GLIDE 0x01
+#define PACKED_OBSTRUENT 0x02
+#define PACKED_BUZZ_SHIFT 2 // BuzzType
+
+// PackedPhonemeFlags.sources: SoundSource of each part, 2 bits each
+#define PACKED_PRESRC_SHIFT 0
+#define PACKED_NSRC_SHIFT 2
+#define PACKED_POSTSRC_SHIFT 4
+
+typedef struct {
+	uint8_t bits;
+	uint8_t sources;
+	uint8_t ndur; // nucleus duration
+	uint8_t tdur; // transition duration
+} PackedPhonemeFlags;
+
+typedef struct packed_voice {
+	uint16_t pitch; // accumulator units
+	uint8_t rate;
+	uint8_t reserved;
+	PackedPhonemeFlags flags[PHONEME_TYPE_COUNT];
+	uint8_t type[N_PHONEME];
+	// F1..F3 of every phoneme
+	uint8_t f[N_FREQ-1][N_PHONEME];
+	// F1..F3 of the obstruent targets of every phoneme
+	uint8_t obstargets[N_OBS][N_FREQ-1][N_PHONEME];
+} PackedVoice;
+
+/*
+ * A frequency code has a 3-bit exponent and a 5-bit mantissa with an implicit
+ * leading 1, like a tiny float. Code 0 is no frequency. Codes run from about
+ * 32Hz to 7.9kHz at 16kHz with steps of 1/32 to 1/64, so encoding is within
+ * 1.6% of the frequency.
+ */
+#define VOICE_FREQ_SHIFT 2
+
+static inline unsigned short voice_freq_decode(uint8_t code)
+{
+	if (code == 0)
+		return 0;
+	return (32 + (code & 31)) << ((code >> 5) + VOICE_FREQ_SHIFT);
+}
+
+// return the code nearest to f (accumulator units)
+uint8_t voice_freq_encode(unsigned short f);
+
+// pack voice v with phoneme flags flags into pv
+// v and flags are read from RAM, so this is for big targets (and build-voice)
+void voice_pack(PackedVoice *pv, const Voice *v, const PhonemeFlags *flags);
+
+// check that v has a pitch and rate, and that every phoneme type and
+// obstruent type of v is in range, so that a voice from outside the program
+// can be planned from safely
+// (reads v from RAM)
+bool voice_packed_check(const PackedVoice *v);
+
+static inline uint8_t voice_packed_type(const PackedVoice *v, int p)
+{
+	return pgm_read_byte(&v->type[p]);
+}
+
+// decode F0 (0 or 1 for a voiced phoneme) to F3 of phoneme p
+static inline void voice_packed_freqs(const PackedVoice *v, int p,
+                                      FreqSet *f)
+{
+	int i;
+	f->f[0] = (voice_packed_type(v, p) & PACKED_VOICED) != 0;
+	for (i = 1; i < N_FREQ; ++i)
+		f->f[i] = voice_freq_decode(pgm_read_byte(&v->f[i-1][p]));
+}
+
+// decode obstruent target type of phoneme p, with F0 0
+static inline void voice_packed_obstargets(const PackedVoice *v, int p,
+                                           ObsType type, FreqSet *f)
+{
+	int i;
+	f->f[0] = 0;
+	for (i = 1; i < N_FREQ; ++i)
+		f->f[i] = voice_freq_decode(
+		  pgm_read_byte(&v->obstargets[type][i-1][p]));
+}
+
+// decode the flags of phoneme type type
+static inline void voice_packed_flags(const PackedVoice *v, int type,
+                                      PhonemeFlags *flags)
+{
+	const PackedPhonemeFlags *pf = &v->flags[type];
+	uint8_t bits = pgm_read_byte(&pf->bits);
+	uint8_t sources = pgm_read_byte(&pf->sources);
+	flags->glide = (bits & PACKED_GLIDE) != 0;
+	flags->obstruent = (bits & PACKED_OBSTRUENT) != 0;
+	flags->buzz = bits >> PACKED_BUZZ_SHIFT;
+	flags->presrc = (sources >> PACKED_PRESRC_SHIFT) & 3;
+	flags->nsrc = (sources >> PACKED_NSRC_SHIFT) & 3;
+	flags->postsrc = (sources >> PACKED_POSTSRC_SHIFT) & 3;
+	flags->ndur = pgm_read_byte(&pf->ndur);
+	flags->tdur = pgm_read_byte(&pf->tdur);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
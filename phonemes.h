@@ -6,6 +6,10 @@
 
 #include "formant.h"
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 #define N_PHONEME P_LAST //40
 
 enum {
@@ -253,4 +257,8 @@ typedef struct {
 
 extern const Phoneme *const phonemes[];
 
+#ifdef __cplusplus
+}
+#endif
+
 #endif
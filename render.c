@@ -5,93 +5,453 @@
 #include "audio.h"
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
 
-#if BIG_TARGET
-#define OUT(s) out(s)
+// scalar kernels
+// these are the reference that the SIMD kernels below must match exactly
+//
+// render kernels write their samples to a buffer supplied by the caller,
+// which hands the whole buffer to the output sink at once
+#define KERNEL_NAME(name) name##_scalar
+#define KERNEL_SINK(s) (*buf++ = (s))
+#define KERNEL_SINK_ARGS , mono8 *buf
+#include "kernel.h"
+
+const wavetable_t *const buzz_wavetables[N_WAVE] PROGMEM = {
+#if BUZZ_MULTIPLY
+	[WAVE_SINE] = &sine_wavetable,
 #else
-#define OUT(s) audio_play_sample(s)
-#endif
-
-// shift phase accumulator right LOG2_PHASE_MODULUS-LOG2_*_WAVETABLE_PERIOD bits
-// mask lowest LOG2_*_WAVETABLE_SIZE bits
-// where * is BUZZ or FRIC
-
-#define ADDOSC(o) do { \
-	o.phase += o.freq; \
-	o.phase &= 0xffff; \
-	/* \
-	 * shift and mask phase to get upper bits which is used \
-	 * as the position in the waveform table \
-	 */ \
-	pos = (o.phase >> (LOG2_PHASE_MODULUS-LOG2_BUZZ_WAVETABLE_PERIOD)) & (BUZZ_WAVETABLE_SIZE-1); \
-	/*fprintf(stderr, "%5d %d: sample=%d\n", i, j, o->waveform.periodic->samples[pos]); */\
-	s += pgm_read_mono8(&o.waveform->samples[pos]); \
-} while (0)
-
-void render_formants(oscillator *const osc, int nsamp, void (*out)(mono8))
+	[WAVE_SINE+0] = &sine_wavetables[0],
+	[WAVE_SINE+1] = &sine_wavetables[1],
+	[WAVE_SINE+2] = &sine_wavetables[2],
+	[WAVE_SINE+3] = &sine_wavetables[3],
+#endif
+	[WAVE_VOWEL_BUZZ] = &vowel_buzz,
+	[WAVE_NASAL_BUZZ] = &nasal_buzz,
+	[WAVE_FRICATION_BUZZ] = &frication_buzz,
+};
+
+void render_formants(oscillator_bank *const bank, int nsamp, mono8 *buf)
+{
+	formants_scalar(bank, nsamp, buf);
+}
+
+void render_fricative(fric_oscillator_bank *const bank, int nsamp, mono8 *buf)
+{
+	fricative_scalar(bank, nsamp, buf);
+}
+
+void render_silence(int nsamp, mono8 *buf)
 {
+	// silence is all zero bytes, so a block fill does it
+	memset(buf, 0, nsamp);
+}
+
+#ifndef RENDER_SIMD
+# if BIG_TARGET && defined(__GNUC__) && BUZZ_WAVETABLE_SIZE == 32 && \
+     (defined(__x86_64__) || defined(__i386__) || defined(__ARM_NEON))
+#  define RENDER_SIMD 1
+# else
+#  define RENDER_SIMD 0
+# endif
+#endif
+
+#if RENDER_SIMD
+/*
+ * SIMD kernels using GCC vector extensions. These render RENDER_SIMD_WIDTH
+ * consecutive samples per iteration and must give exactly the same output as
+ * the scalar kernels above. Leftover samples are rendered by the scalar
+ * kernels.
+ *
+ * The kernels are written once and compiled for each instruction set that we
+ * dispatch to at run time (see render_select_kernels()).
+ */
+#define RENDER_SIMD_WIDTH 16
+#define SIMD_INLINE static inline __attribute__((always_inline))
+
+typedef unsigned short v16hu __attribute__((vector_size(32)));
+typedef short v16hs __attribute__((vector_size(32)));
+typedef unsigned char v16qu __attribute__((vector_size(16)));
+typedef signed char v16qs __attribute__((vector_size(16)));
+typedef uint32_t v8su __attribute__((vector_size(32)));
+typedef int32_t v8si __attribute__((vector_size(32)));
+typedef short v8hs __attribute__((vector_size(16)));
+
+/*
+ * The phase of sample k (1..16) of a 16-bit oscillator is phase + k*freq,
+ * which wraps at 16 bits exactly like the scalar accumulator does. The upper
+ * 5 bits of each phase select one of the 32 wavetable entries, so the lookup
+ * is a two-register byte shuffle of the wavetable. Samples are summed in 8
+ * bits, which wraps the same way as the scalar path's conversion of the int
+ * sum to mono8. In multiply mode the scaled samples need 16 bits, so they
+ * are summed in 16 bits and truncated at the end.
+ */
+SIMD_INLINE void formants_simd(oscillator_bank *const bank, int nsamp,
+                               mono8 *buf)
+{
+	static const v16hu ramp = {
+		1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+	};
+	v16qs lo[N_FORMANTS_FLATOSC], hi[N_FORMANTS_FLATOSC];
 	int i, j;
-	unsigned pos;
-#define N_FORMANTS_FLATOSC 7
-	for (i = 0; i < nsamp; ++i) {
-		int s = 0;
+
+	for (j = 0; j < N_FORMANTS_FLATOSC; ++j) {
+		const wavetable_t *w = wavetable_from_index(bank->wave[j]);
+		memcpy(&lo[j], &w->samples[0], sizeof lo[j]);
+		memcpy(&hi[j], &w->samples[16], sizeof hi[j]);
+	}
+
+	for (i = 0; i + RENDER_SIMD_WIDTH <= nsamp; i += RENDER_SIMD_WIDTH) {
+#if BUZZ_MULTIPLY
+		v16hs s = { 0 };
+#else
+		v16qs s = { 0 };
+#endif
 		for (j = 0; j < N_FORMANTS_FLATOSC; ++j) {
-			ADDOSC(osc[j]);
+			unsigned short freq = bank->freq[j];
+			v16hu phase = bank->phase[j] + ramp * freq;
+			v16qu pos = __builtin_convertvector(
+			  phase >> (LOG2_PHASE_MODULUS-LOG2_BUZZ_WAVETABLE_PERIOD),
+			  v16qu);
+#if BUZZ_MULTIPLY
+			v16hs w = __builtin_convertvector(
+			  __builtin_shuffle(lo[j], hi[j], pos), v16hs);
+			s += j == 0 ? w : (w * (short)bank->gain[j] + 128) >> 8;
+#else
+			s += __builtin_shuffle(lo[j], hi[j], pos);
+#endif
+			bank->phase[j] += RENDER_SIMD_WIDTH * freq;
 		}
-		OUT(s);
+#if BUZZ_MULTIPLY
+		v16qs s8 = __builtin_convertvector(s, v16qs);
+		memcpy(buf + i, &s8, sizeof s8);
+#else
+		memcpy(buf + i, &s, sizeof s);
+#endif
 	}
+	formants_scalar(bank, nsamp - i, buf + i);
 }
 
-#define ADDFRIC(o) do { \
-	o.phase += o.freq; \
-	/*o.phase &= 0xffffffff; */\
-	/* \
-	 * shift and mask phase to get upper bits which is used \
-	 * as the position in the waveform table \
-	 */ \
-	pos = (o.phase >> (LOG2_PHASE_MODULUS-LOG2_FRIC_WAVETABLE_PERIOD)) & (FRIC_WAVETABLE_SIZE-1); \
-	/*fprintf(stderr, "pos=%u\n", pos);*/ \
-	/*fprintf(stderr, "%5d %d: sample=%d\n", i, j, o.waveform.aperiodic->samples[pos]); */\
-	s += pgm_read_mono8(&frication_wavetable.samples[pos]); \
-} while (0)
-
-#define AMPMOD_ADDOSC(o) do { \
-	o.phase += o.freq; \
-	o.phase &= 0xffffffff; \
-	/* \
-	 * shift and mask phase to get upper bits which is used \
-	 * as the position in the waveform table \
-	 */ \
-	pos = (o.phase >> (LOG2_PHASE_MODULUS-LOG2_BUZZ_WAVETABLE_PERIOD)) & (BUZZ_WAVETABLE_SIZE-1); \
-	/* XXX multiplication by 4 is a hack. fix build-wave.c instead! */ \
-	mod = 1*(int)pgm_read_mono8(&frication_buzz.samples[pos]) + 128; \
-	s = (s * mod / 256) + pgm_read_mono8(&vowel_buzz.samples[pos]); \
-} while (0)
-
-// We use only one frication wavetable and one frication buzz wavetable. The
-// frication wavetable is fairly large (larger than the buzz and sine
-// wavetables) to minimize its periodicity.
-void render_fricative(fric_oscillator *const osc, int nsamp, void (*out)(mono8))
+/*
+ * The frication wavetable is too big to shuffle, so it is looked up with a
+ * gather: the phases of 16 samples are built in 32 bits (the frication phase
+ * accumulators wrap at 32 bits), masked to the table, and the samples loaded
+ * into two vectors of eight 32-bit sums (AVX2 has no wider vectors, and
+ * GCC's lowering of 16 x 32 bits to them costs more than the gathers save).
+ * x86 gathers load at least 32 bits per lane, so they read fric_wavetable32,
+ * a copy of the table widened to 32 bits (8KB, which stays in L1). Without a
+ * gather instruction, the lanes are loaded one at a time.
+ *
+ * Procedural noise (FRIC_NOISE_LFSR) has a serial generator, so it is summed
+ * one lane at a time.
+ *
+ * The voice bar is then applied to 16 samples at once. It only looks at bits
+ * 11..15 of its phase, so its phase ramp can be built in 16 bits like the buzz
+ * oscillators. The amplitude modulation is done in 16 bits too: only the low 8
+ * bits of each output sample survive, and those depend only on the low 16 bits
+ * of s*mod, which a 16-bit multiply gives exactly. s*mod/256 truncates toward
+ * zero, so a negative product that is not a multiple of 256 is rounded up by
+ * one from the arithmetic shift.
+ */
+#if !FRIC_NOISE_LFSR
+// add the samples at pos to s
+typedef void fric_gather_fn(v8si *s, const v8su *pos);
+#else
+// noise is not looked up
+typedef void fric_gather_fn;
+#endif
+
+SIMD_INLINE void fricative_simd(fric_oscillator_bank *const bank, int nsamp,
+                                mono8 *buf, fric_gather_fn *gather)
 {
+	static const v16hu ramp = {
+		1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+	};
+#if !FRIC_NOISE_LFSR
+	static const v8su ramp32 = { 1, 2, 3, 4, 5, 6, 7, 8 };
+#endif
+	v16qs mod_lo, mod_hi, buzz_lo, buzz_hi;
 	int i, j;
-	unsigned pos;
-	int mod;
-#define N_FRICATIVE_FLATOSC 3
-	for (i = 0; i < nsamp; ++i) {
-		int s = 0;
+
+	memcpy(&mod_lo, &frication_buzz.samples[0], sizeof mod_lo);
+	memcpy(&mod_hi, &frication_buzz.samples[16], sizeof mod_hi);
+	memcpy(&buzz_lo, &vowel_buzz.samples[0], sizeof buzz_lo);
+	memcpy(&buzz_hi, &vowel_buzz.samples[16], sizeof buzz_hi);
+
+	for (i = 0; i + RENDER_SIMD_WIDTH <= nsamp; i += RENDER_SIMD_WIDTH) {
+		v16hs s;
+#if FRIC_NOISE_LFSR
+		short fric[RENDER_SIMD_WIDTH] = { 0 };
+		int k;
+		for (j = 0; j < N_FRICATIVE_FLATOSC; ++j) {
+			uint32_t phase = bank->phase[j];
+			unsigned short freq = bank->freq[j];
+			int8_t noise = bank->noise[j];
+			uint16_t lfsr = bank->lfsr[j];
+			for (k = 0; k < RENDER_SIMD_WIDTH; ++k) {
+				fric[k] += FRIC_NEXT(phase, freq, noise, lfsr);
+			}
+			bank->phase[j] = phase;
+			bank->noise[j] = noise;
+			bank->lfsr[j] = lfsr;
+		}
+		memcpy(&s, fric, sizeof s);
+		(void)gather;
+#else
+		v8si lo = { 0 }, hi = { 0 };
 		for (j = 0; j < N_FRICATIVE_FLATOSC; ++j) {
-			ADDFRIC(osc[j]);
+			uint32_t freq = bank->freq[j];
+			v8su phase = bank->phase[j] + ramp32 * freq;
+			v8su pos = phase >>
+			  (LOG2_PHASE_MODULUS-LOG2_FRIC_WAVETABLE_PERIOD) &
+			  (FRIC_WAVETABLE_SIZE-1);
+			gather(&lo, &pos);
+			pos = (phase + 8 * freq) >>
+			  (LOG2_PHASE_MODULUS-LOG2_FRIC_WAVETABLE_PERIOD) &
+			  (FRIC_WAVETABLE_SIZE-1);
+			gather(&hi, &pos);
+			bank->phase[j] += RENDER_SIMD_WIDTH * freq;
 		}
-		AMPMOD_ADDOSC(osc[j]);
-		OUT(s);
+		v8hs lo16 = __builtin_convertvector(lo, v8hs);
+		v8hs hi16 = __builtin_convertvector(hi, v8hs);
+		memcpy(&s, &lo16, sizeof lo16);
+		memcpy((char *)&s + sizeof lo16, &hi16, sizeof hi16);
+#endif
+
+		// voice bar
+		unsigned short freq = bank->freq[j];
+		v16hu phase = (unsigned short)bank->phase[j] + ramp * freq;
+		v16qu pos = __builtin_convertvector(
+		  phase >> (LOG2_PHASE_MODULUS-LOG2_BUZZ_WAVETABLE_PERIOD), v16qu);
+		v16hu mod = (v16hu)__builtin_convertvector(
+		  __builtin_shuffle(mod_lo, mod_hi, pos), v16hs) + 128;
+		v16hu buzz = (v16hu)__builtin_convertvector(
+		  __builtin_shuffle(buzz_lo, buzz_hi, pos), v16hs);
+		v16hu prod = (v16hu)s * mod;
+		// comparisons give -1 where true, so subtracting rounds up
+		v16hu round = (v16hu)((s < 0) & ((v16hs)(prod & 0xff) != 0));
+		v16hu out = (prod >> 8) - round + buzz;
+		bank->phase[j] += RENDER_SIMD_WIDTH * freq;
+
+		v16qu out8 = __builtin_convertvector(out, v16qu);
+		memcpy(buf + i, &out8, sizeof out8);
 	}
+	fricative_scalar(bank, nsamp - i, buf + i);
+}
+
+#define DEFINE_SIMD_FORMANTS(isa, attr) \
+static attr void render_formants_##isa(oscillator_bank *const bank, \
+                                       int nsamp, mono8 *buf) \
+{ \
+	formants_simd(bank, nsamp, buf); \
 }
 
-void render_silence(int nsamp, void (*out)(mono8))
+#define DEFINE_SIMD_FRICATIVE(isa, attr, gather) \
+static attr void render_fricative_##isa(fric_oscillator_bank *const bank, \
+                                        int nsamp, mono8 *buf) \
+{ \
+	fricative_simd(bank, nsamp, buf, gather); \
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+// plain SSE2 has no byte shuffle, which makes the SIMD kernels slower than the
+// scalar ones, so SSSE3 is the lowest level we dispatch to
+#define SSSE3 __attribute__((target("ssse3")))
+#define AVX2 __attribute__((target("avx2")))
+#define AVX512 __attribute__((target("avx512bw,avx512vl,avx512vbmi")))
+
+#if !FRIC_NOISE_LFSR
+#include <immintrin.h>
+
+static int32_t fric_wavetable32[FRIC_WAVETABLE_SIZE];
+
+__attribute__((constructor)) static void widen_fric_wavetable(void)
 {
 	int i;
-	for (i = 0; i < nsamp; ++i) {
-		OUT(0);
+	for (i = 0; i < FRIC_WAVETABLE_SIZE; ++i)
+		fric_wavetable32[i] = frication_wavetable.samples[i];
+}
+
+// AVX-512 has the same 8-lane gather (with VL), so both kernels use it
+SIMD_INLINE AVX2 void fric_gather_avx2(v8si *s, const v8su *pos)
+{
+	*s += (v8si)_mm256_i32gather_epi32(fric_wavetable32, (__m256i)*pos, 4);
+}
+#else
+# define fric_gather_avx2 NULL
+#endif
+
+DEFINE_SIMD_FORMANTS(ssse3, SSSE3)
+DEFINE_SIMD_FORMANTS(avx2, AVX2)
+DEFINE_SIMD_FRICATIVE(avx2, AVX2, fric_gather_avx2)
+DEFINE_SIMD_FORMANTS(avx512, AVX512)
+DEFINE_SIMD_FRICATIVE(avx512, AVX512, fric_gather_avx2)
+
+static const struct render_kernels kernels_avx512 = {
+	.name = "avx512",
+	.formants = render_formants_avx512,
+	.fricative = render_fricative_avx512,
+};
+
+static const struct render_kernels kernels_avx2 = {
+	.name = "avx2",
+	.formants = render_formants_avx2,
+	.fricative = render_fricative_avx2,
+};
+
+// the 16-bit voice bar math needs AVX2 to beat the scalar fricative kernel
+static const struct render_kernels kernels_ssse3 = {
+	.name = "ssse3",
+	.formants = render_formants_ssse3,
+	.fricative = render_fricative,
+};
+#else
+#if !FRIC_NOISE_LFSR
+// NEON has no gather
+SIMD_INLINE void fric_gather_lanes(v8si *s, const v8su *pos)
+{
+	int k;
+	for (k = 0; k < 8; ++k)
+		(*s)[k] += frication_wavetable.samples[(*pos)[k]];
+}
+#else
+# define fric_gather_lanes NULL
+#endif
+
+DEFINE_SIMD_FORMANTS(neon, )
+DEFINE_SIMD_FRICATIVE(neon, , fric_gather_lanes)
+
+static const struct render_kernels kernels_neon = {
+	.name = "neon",
+	.formants = render_formants_neon,
+	.fricative = render_fricative_neon,
+};
+#endif
+#endif
+
+/*
+ * Coefficients of the odd (interpolating) phase of a 15-tap half-band filter
+ * (windowed sinc), scaled so that each side sums to 64. The image band (3/4
+ * to all of the input rate) is attenuated by about 40dB, which is as much as
+ * 8-bit samples can show. Sums fit in 16 bits.
+ */
+static const short halfband_coef[HALFBAND_TAPS] PROGMEM = {
+	79, -21, 8, -2,
+};
+
+void render_upsample2(struct halfband *hb, const mono8 *in, int n,
+                      mono8 *out)
+{
+	// the history followed by the input, so in and out may overlap
+	mono8 x[2*HALFBAND_TAPS - 1 + BLOCK_SAMPLES/2];
+	short c[HALFBAND_TAPS];
+	int i = 0, k;
+
+	for (k = 0; k < HALFBAND_TAPS; ++k)
+		c[k] = pgm_read_short(&halfband_coef[k]);
+	memcpy(x, hb->hist, sizeof hb->hist);
+	memcpy(x + sizeof hb->hist, in, n);
+
+#if RENDER_SIMD && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+	// RENDER_SIMD_WIDTH input samples at a time, in 16 bits; each pair of
+	// output samples is stored as one 16-bit word
+	for (; i + RENDER_SIMD_WIDTH <= n; i += RENDER_SIMD_WIDTH) {
+		v16qs a, b;
+		// the first tap is next to the even (input) samples
+		memcpy(&a, x + i + HALFBAND_TAPS-1, sizeof a);
+		memcpy(&b, x + i + HALFBAND_TAPS, sizeof b);
+		v16hs even = __builtin_convertvector(a, v16hs);
+		v16hs s = 64 + c[0] * (even + __builtin_convertvector(b, v16hs));
+		for (k = 1; k < HALFBAND_TAPS; ++k) {
+			memcpy(&a, x + i + HALFBAND_TAPS-1 - k, sizeof a);
+			memcpy(&b, x + i + HALFBAND_TAPS + k, sizeof b);
+			s += c[k] * (__builtin_convertvector(a, v16hs) +
+			             __builtin_convertvector(b, v16hs));
+		}
+		s >>= 7;
+		// clamp (comparisons give -1 where true)
+		v16hs lo = s < -128, hi = s > 127;
+		s = (s & ~lo) | (lo & -128);
+		s = (s & ~hi) | (hi & 127);
+		v16hu w = ((v16hu)even & 0xff) | (v16hu)s << 8;
+		memcpy(out + 2*i, &w, sizeof w);
 	}
+#endif
+	for (; i < n; ++i) {
+		// interpolate between m[0] and m[1]
+		const mono8 *m = x + i + HALFBAND_TAPS - 1;
+		int s = 64;
+		for (k = 0; k < HALFBAND_TAPS; ++k)
+			s += c[k] * (m[-k] + m[1+k]);
+		s >>= 7;
+		out[2*i] = m[0];
+		out[2*i+1] = s < -128 ? -128 : s > 127 ? 127 : s;
+	}
+	memcpy(hb->hist, x + n, sizeof hb->hist);
+}
+
+static const struct render_kernels kernels_scalar = {
+	.name = "scalar",
+	.formants = render_formants,
+	.fricative = render_fricative,
+};
+
+// all kernels, best first
+static const struct render_kernels *const all_kernels[] = {
+#if RENDER_SIMD
+#if defined(__x86_64__) || defined(__i386__)
+	&kernels_avx512,
+	&kernels_avx2,
+	&kernels_ssse3,
+#else
+	&kernels_neon,
+#endif
+#endif
+	&kernels_scalar,
+};
+
+static bool kernels_supported(const struct render_kernels *k)
+{
+#if RENDER_SIMD && (defined(__x86_64__) || defined(__i386__))
+	__builtin_cpu_init();
+	if (k == &kernels_avx512)
+		return __builtin_cpu_supports("avx512bw") &&
+		       __builtin_cpu_supports("avx512vl") &&
+		       __builtin_cpu_supports("avx512vbmi");
+	if (k == &kernels_avx2)
+		return __builtin_cpu_supports("avx2");
+	if (k == &kernels_ssse3)
+		return __builtin_cpu_supports("ssse3");
+#endif
+	return true;
 }
 
+/*
+ * Pick the best render kernels that this CPU can run.
+ *
+ * On big targets the JUNO_KERNELS environment variable may name a particular
+ * set of kernels (eg, "scalar") to compare them against each other.
+ */
+const struct render_kernels *render_select_kernels(void)
+{
+	int i;
+	int n = sizeof all_kernels / sizeof all_kernels[0];
+#if BIG_TARGET
+	const char *want = getenv("JUNO_KERNELS");
+	if (want) {
+		for (i = 0; i < n; ++i) {
+			if (strcmp(all_kernels[i]->name, want) == 0 &&
+			    kernels_supported(all_kernels[i]))
+				return all_kernels[i];
+		}
+		fprintf(stderr, "# JUNO_KERNELS=%s is not available\n", want);
+	}
+#endif
+	for (i = 0; i < n; ++i) {
+		if (kernels_supported(all_kernels[i]))
+			return all_kernels[i];
+	}
+	return &kernels_scalar;
+}
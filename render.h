@@ -4,9 +4,41 @@
 #include "oscillator.h"
 #include "wave.h"
 
-void render_formants(oscillator *const osc, int nsamp, void (*out)(mono8));
-void render_fricative(fric_oscillator *const osc, int nsamp,
- 		void (*out)(mono8));
-void render_silence(int nsamp, void (*out)(mono8));
+void render_formants(oscillator_bank *const bank, int nsamp, mono8 *buf);
+void render_fricative(fric_oscillator_bank *const bank, int nsamp, mono8 *buf);
+void render_silence(int nsamp, mono8 *buf);
+
+/*
+ * Render kernels for one instruction set. render_formants and
+ * render_fricative above are the scalar reference implementations; other
+ * kernels produce exactly the same output.
+ */
+struct render_kernels {
+	const char *name;
+	void (*formants)(oscillator_bank *const bank, int nsamp, mono8 *buf);
+	void (*fricative)(fric_oscillator_bank *const bank, int nsamp,
+	                  mono8 *buf);
+};
+
+const struct render_kernels *render_select_kernels(void);
+
+/*
+ * Half-band interpolator for buzz rendered at a lower sample rate (see
+ * BUZZ_DECIMATION). render_upsample2 doubles the sample rate of n samples
+ * from in, writing 2*n samples to out; in and out may be the same buffer.
+ * n must be at most BLOCK_SAMPLES/2.
+ *
+ * The even output samples are the input samples and the odd ones are
+ * interpolated from HALFBAND_TAPS input samples on either side, so the output
+ * is delayed by HALFBAND_TAPS input samples. hist carries the last input
+ * samples from one call to the next; clear it to start a new signal.
+ */
+#define HALFBAND_TAPS 4
+struct halfband {
+	mono8 hist[2*HALFBAND_TAPS - 1];
+};
+
+void render_upsample2(struct halfband *hb, const mono8 *in, int n,
+                      mono8 *out);
 
 #endif
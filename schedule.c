@@ -0,0 +1,2128 @@
+/* THIS FILE IS AUTO-GENERATED! DO NOT EDIT THIS FILE. */
+
+#include "juno.h"
+#include "diphone.h"
+#include "bob.h"
+
+#if DIPHONE_TABLE
+
+#if SAMPLE_RATE != 16000 || SLICES_PER_SECOND != 250
+#error no diphone tables for this SAMPLE_RATE and SLICES_PER_SECOND (build-schedule builds them for the host)
+#endif
+
+const Voice *const diphone_table_voice = &voiceBob;
+
+const FreqSet diphone_freqs[624] PROGMEM = {
+	{ .f = { 0, 0, 0, 0 } }, // 0
+	{ .f = { 1, 962, 8601, 12288 } }, // 1
+	{ .f = { 2, 962, 8601, 12288 } }, // 2
+	{ .f = { 1, 1146, 3244, 8826 } }, // 3
+	{ .f = { 2, 1146, 3244, 8826 } }, // 4
+	{ .f = { 1, 1404, 9515, 12288 } }, // 5
+	{ .f = { 2, 1404, 9515, 12288 } }, // 6
+	{ .f = { 1, 1556, 4063, 9646 } }, // 7
+	{ .f = { 2, 1556, 4063, 9646 } }, // 8
+	{ .f = { 1, 1757, 8331, 11005 } }, // 9
+	{ .f = { 2, 1757, 8331, 11005 } }, // 10
+	{ .f = { 1, 1921, 4599, 9973 } }, // 11
+	{ .f = { 2, 1921, 4599, 9973 } }, // 12
+	{ .f = { 1, 1949, 8560, 11026 } }, // 13
+	{ .f = { 2, 1949, 8560, 11026 } }, // 14
+	{ .f = { 1, 2039, 3727, 10072 } }, // 15
+	{ .f = { 2, 2039, 3727, 10072 } }, // 16
+	{ .f = { 1, 2543, 4878, 10436 } }, // 17
+	{ .f = { 2, 2543, 4878, 10436 } }, // 18
+	{ .f = { 1, 2048, 6144, 10240 } }, // 19
+	{ .f = { 2, 2048, 6144, 10240 } }, // 20
+	{ .f = { 1, 1228, 6144, 6963 } }, // 21
+	{ .f = { 2, 1228, 6144, 6963 } }, // 22
+	{ .f = { 1, 2408, 7385, 10665 } }, // 23
+	{ .f = { 2, 2408, 7385, 10665 } }, // 24
+	{ .f = { 1, 2686, 4190, 10326 } }, // 25
+	{ .f = { 2, 2686, 4190, 10326 } }, // 26
+	{ .f = { 1, 2457, 8396, 10629 } }, // 27
+	{ .f = { 2, 2457, 8396, 10629 } }, // 28
+	{ .f = { 1, 2867, 7372, 10649 } }, // 29
+	{ .f = { 2, 2867, 7372, 10649 } }, // 30
+	{ .f = { 1, 3096, 5361, 10383 } }, // 31
+	{ .f = { 2, 3096, 5361, 10383 } }, // 32
+	{ .f = { 1, 1228, 6144, 11468 } }, // 33
+	{ .f = { 2, 1228, 6144, 11468 } }, // 34
+	{ .f = { 1, 1228, 4505, 7782 } }, // 35
+	{ .f = { 2, 1228, 4505, 7782 } }, // 36
+	{ .f = { 1, 0, 0, 0 } }, // 37
+	{ .f = { 2, 0, 0, 0 } }, // 38
+	{ .f = { 1, 1054, 5923, 10557 } }, // 39
+	{ .f = { 1, 1241, 9178, 12288 } }, // 40
+	{ .f = { 1, 1337, 5735, 10620 } }, // 41
+	{ .f = { 1, 1464, 8431, 11478 } }, // 42
+	{ .f = { 1, 1567, 6074, 10826 } }, // 43
+	{ .f = { 1, 1585, 8576, 11491 } }, // 44
+	{ .f = { 1, 1642, 5523, 10889 } }, // 45
+	{ .f = { 1, 1960, 6250, 11119 } }, // 46
+	{ .f = { 1, 1647, 7050, 10995 } }, // 47
+	{ .f = { 1, 1130, 7050, 8925 } }, // 48
+	{ .f = { 1, 1875, 7833, 11263 } }, // 49
+	{ .f = { 1, 2050, 5816, 11049 } }, // 50
+	{ .f = { 1, 1906, 8472, 11241 } }, // 51
+	{ .f = { 1, 2165, 7825, 11253 } }, // 52
+	{ .f = { 1, 2309, 6555, 11085 } }, // 53
+	{ .f = { 1, 1139, 6963, 11742 } }, // 54
+	{ .f = { 1, 1139, 5871, 9284 } }, // 55
+	{ .f = { 1, 820, 4721, 12288 } }, // 56
+	{ .f = { 2, 737, 2457, 12288 } }, // 57
+	{ .f = { 1, 820, 7567, 12288 } }, // 58
+	{ .f = { 2, 737, 6963, 12288 } }, // 59
+	{ .f = { 1, 820, 10153, 12288 } }, // 60
+	{ .f = { 2, 737, 11059, 12288 } }, // 61
+	{ .f = { 1, 804, 4265, 12288 } }, // 62
+	{ .f = { 1, 804, 7445, 12288 } }, // 63
+	{ .f = { 1, 804, 10336, 12288 } }, // 64
+	{ .f = { 1, 1054, 5922, 10557 } }, // 65
+	{ .f = { 1, 1308, 7204, 11012 } }, // 66
+	{ .f = { 1, 1404, 3761, 9343 } }, // 67
+	{ .f = { 1, 1531, 6456, 10202 } }, // 68
+	{ .f = { 1, 1635, 4099, 9550 } }, // 69
+	{ .f = { 1, 1653, 6601, 10215 } }, // 70
+	{ .f = { 1, 1710, 3549, 9612 } }, // 71
+	{ .f = { 1, 2028, 4276, 9842 } }, // 72
+	{ .f = { 1, 1715, 5075, 9719 } }, // 73
+	{ .f = { 1, 1197, 5075, 7650 } }, // 74
+	{ .f = { 1, 1943, 5859, 9987 } }, // 75
+	{ .f = { 1, 2118, 3841, 9773 } }, // 76
+	{ .f = { 1, 1974, 6497, 9964 } }, // 77
+	{ .f = { 1, 2232, 5851, 9977 } }, // 78
+	{ .f = { 1, 2377, 4581, 9809 } }, // 79
+	{ .f = { 1, 1200, 5177, 10587 } }, // 80
+	{ .f = { 1, 1200, 4084, 8130 } }, // 81
+	{ .f = { 1, 888, 2747, 9343 } }, // 82
+	{ .f = { 2, 737, 2457, 9646 } }, // 83
+	{ .f = { 1, 888, 5592, 9343 } }, // 84
+	{ .f = { 2, 737, 6963, 9646 } }, // 85
+	{ .f = { 1, 888, 5075, 7908 } }, // 86
+	{ .f = { 2, 737, 6144, 7372 } }, // 87
+	{ .f = { 1, 858, 2689, 9404 } }, // 88
+	{ .f = { 1, 858, 5869, 9404 } }, // 89
+	{ .f = { 1, 858, 5291, 7800 } }, // 90
+	{ .f = { 1, 1242, 9179, 12288 } }, // 91
+	{ .f = { 1, 1309, 7205, 11013 } }, // 92
+	{ .f = { 1, 1480, 6789, 10967 } }, // 93
+	{ .f = { 1, 1580, 8923, 11647 } }, // 94
+	{ .f = { 1, 1662, 7057, 11131 } }, // 95
+	{ .f = { 1, 1676, 9038, 11657 } }, // 96
+	{ .f = { 1, 1721, 6621, 11180 } }, // 97
+	{ .f = { 1, 1973, 7197, 11362 } }, // 98
+	{ .f = { 1, 1726, 7830, 11264 } }, // 99
+	{ .f = { 1, 1316, 7830, 9626 } }, // 100
+	{ .f = { 1, 1906, 8450, 11477 } }, // 101
+	{ .f = { 1, 2045, 6853, 11307 } }, // 102
+	{ .f = { 1, 1930, 8956, 11459 } }, // 103
+	{ .f = { 1, 2135, 8444, 11469 } }, // 104
+	{ .f = { 1, 2250, 7438, 11336 } }, // 105
+	{ .f = { 1, 1310, 7700, 11847 } }, // 106
+	{ .f = { 1, 1310, 6818, 9862 } }, // 107
+	{ .f = { 1, 1071, 5986, 12288 } }, // 108
+	{ .f = { 1, 1071, 8239, 12288 } }, // 109
+	{ .f = { 1, 1071, 10287, 12288 } }, // 110
+	{ .f = { 1, 1015, 5398, 12288 } }, // 111
+	{ .f = { 1, 1015, 8027, 12288 } }, // 112
+	{ .f = { 1, 1015, 10415, 12288 } }, // 113
+	{ .f = { 1, 1338, 5734, 10619 } }, // 114
+	{ .f = { 1, 1405, 3762, 9344 } }, // 115
+	{ .f = { 1, 1656, 6197, 10325 } }, // 116
+	{ .f = { 1, 1738, 4331, 9809 } }, // 117
+	{ .f = { 1, 1752, 6311, 10336 } }, // 118
+	{ .f = { 1, 1797, 3895, 9859 } }, // 119
+	{ .f = { 1, 2049, 4470, 10041 } }, // 120
+	{ .f = { 1, 1802, 5103, 9943 } }, // 121
+	{ .f = { 1, 1392, 5103, 8305 } }, // 122
+	{ .f = { 1, 1982, 5724, 10155 } }, // 123
+	{ .f = { 1, 2121, 4126, 9986 } }, // 124
+	{ .f = { 1, 2006, 6229, 10137 } }, // 125
+	{ .f = { 1, 2211, 5717, 10147 } }, // 126
+	{ .f = { 1, 2326, 4712, 10014 } }, // 127
+	{ .f = { 1, 1380, 5183, 10627 } }, // 128
+	{ .f = { 1, 1380, 4301, 8643 } }, // 129
+	{ .f = { 1, 1147, 3260, 9646 } }, // 130
+	{ .f = { 1, 1147, 5513, 9646 } }, // 131
+	{ .f = { 1, 1147, 5103, 8509 } }, // 132
+	{ .f = { 1, 1079, 3127, 9646 } }, // 133
+	{ .f = { 1, 1079, 5754, 9646 } }, // 134
+	{ .f = { 1, 1079, 5276, 8320 } }, // 135
+	{ .f = { 1, 1465, 8430, 11477 } }, // 136
+	{ .f = { 1, 1532, 6457, 10203 } }, // 137
+	{ .f = { 1, 1581, 8923, 11646 } }, // 138
+	{ .f = { 1, 1657, 6197, 10326 } }, // 139
+	{ .f = { 1, 1839, 6465, 10489 } }, // 140
+	{ .f = { 1, 1853, 8445, 11015 } }, // 141
+	{ .f = { 1, 1898, 6029, 10539 } }, // 142
+	{ .f = { 1, 2150, 6605, 10721 } }, // 143
+	{ .f = { 1, 1902, 7238, 10623 } }, // 144
+	{ .f = { 1, 1493, 7238, 8984 } }, // 145
+	{ .f = { 1, 2082, 7858, 10835 } }, // 146
+	{ .f = { 1, 2221, 6261, 10666 } }, // 147
+	{ .f = { 1, 2107, 8363, 10817 } }, // 148
+	{ .f = { 1, 2312, 7852, 10827 } }, // 149
+	{ .f = { 1, 2426, 6846, 10694 } }, // 150
+	{ .f = { 1, 1473, 7154, 11254 } }, // 151
+	{ .f = { 1, 1473, 6271, 9270 } }, // 152
+	{ .f = { 1, 1247, 5394, 11005 } }, // 153
+	{ .f = { 2, 737, 2457, 11005 } }, // 154
+	{ .f = { 1, 1247, 7647, 11005 } }, // 155
+	{ .f = { 2, 737, 6963, 11005 } }, // 156
+	{ .f = { 1, 1247, 9490, 11441 } }, // 157
+	{ .f = { 2, 737, 10649, 11878 } }, // 158
+	{ .f = { 1, 1162, 4905, 11005 } }, // 159
+	{ .f = { 1, 1162, 7533, 11005 } }, // 160
+	{ .f = { 1, 1162, 9683, 11514 } }, // 161
+	{ .f = { 1, 1568, 6073, 10825 } }, // 162
+	{ .f = { 1, 1636, 4100, 9551 } }, // 163
+	{ .f = { 1, 1663, 7057, 11130 } }, // 164
+	{ .f = { 1, 1739, 4331, 9810 } }, // 165
+	{ .f = { 1, 1935, 6579, 10499 } }, // 166
+	{ .f = { 1, 1980, 4163, 10022 } }, // 167
+	{ .f = { 1, 2232, 4738, 10204 } }, // 168
+	{ .f = { 1, 1984, 5371, 10106 } }, // 169
+	{ .f = { 1, 1575, 5371, 8468 } }, // 170
+	{ .f = { 1, 2164, 5992, 10319 } }, // 171
+	{ .f = { 1, 2303, 4395, 10149 } }, // 172
+	{ .f = { 1, 2189, 6497, 10301 } }, // 173
+	{ .f = { 1, 2394, 5985, 10311 } }, // 174
+	{ .f = { 1, 2508, 4980, 10178 } }, // 175
+	{ .f = { 1, 1548, 5430, 10778 } }, // 176
+	{ .f = { 1, 1548, 4549, 8794 } }, // 177
+	{ .f = { 1, 1329, 3528, 9973 } }, // 178
+	{ .f = { 2, 737, 2457, 9973 } }, // 179
+	{ .f = { 1, 1329, 5781, 9973 } }, // 180
+	{ .f = { 2, 737, 6963, 9973 } }, // 181
+	{ .f = { 1, 1329, 5371, 8673 } }, // 182
+	{ .f = { 1, 1231, 3350, 9973 } }, // 183
+	{ .f = { 1, 1231, 5978, 9973 } }, // 184
+	{ .f = { 1, 1231, 5500, 8456 } }, // 185
+	{ .f = { 1, 1586, 8575, 11490 } }, // 186
+	{ .f = { 1, 1654, 6602, 10216 } }, // 187
+	{ .f = { 1, 1677, 9037, 11657 } }, // 188
+	{ .f = { 1, 1753, 6312, 10336 } }, // 189
+	{ .f = { 1, 1853, 8446, 11016 } }, // 190
+	{ .f = { 1, 1935, 6580, 10500 } }, // 191
+	{ .f = { 1, 1994, 6144, 10549 } }, // 192
+	{ .f = { 1, 2246, 6719, 10731 } }, // 193
+	{ .f = { 1, 1998, 7352, 10633 } }, // 194
+	{ .f = { 1, 1589, 7352, 8995 } }, // 195
+	{ .f = { 1, 2178, 7973, 10846 } }, // 196
+	{ .f = { 1, 2317, 6375, 10676 } }, // 197
+	{ .f = { 1, 2203, 8478, 10828 } }, // 198
+	{ .f = { 1, 2408, 7966, 10838 } }, // 199
+	{ .f = { 1, 2522, 6961, 10705 } }, // 200
+	{ .f = { 1, 1561, 7260, 11264 } }, // 201
+	{ .f = { 1, 1561, 6377, 9280 } }, // 202
+	{ .f = { 1, 1343, 5509, 11026 } }, // 203
+	{ .f = { 2, 737, 2457, 11026 } }, // 204
+	{ .f = { 1, 1343, 7762, 11026 } }, // 205
+	{ .f = { 2, 737, 6963, 11026 } }, // 206
+	{ .f = { 1, 1343, 9604, 11452 } }, // 207
+	{ .f = { 1, 1242, 5000, 11026 } }, // 208
+	{ .f = { 1, 1242, 7629, 11026 } }, // 209
+	{ .f = { 1, 1242, 9778, 11523 } }, // 210
+	{ .f = { 1, 1643, 5522, 10888 } }, // 211
+	{ .f = { 1, 1710, 3550, 9613 } }, // 212
+	{ .f = { 1, 1722, 6621, 11180 } }, // 213
+	{ .f = { 1, 1798, 3895, 9859 } }, // 214
+	{ .f = { 1, 1898, 6029, 10538 } }, // 215
+	{ .f = { 1, 1980, 4163, 10023 } }, // 216
+	{ .f = { 1, 1994, 6143, 10549 } }, // 217
+	{ .f = { 1, 2291, 4302, 10254 } }, // 218
+	{ .f = { 1, 2043, 4935, 10156 } }, // 219
+	{ .f = { 1, 1634, 4935, 8518 } }, // 220
+	{ .f = { 1, 2223, 5556, 10368 } }, // 221
+	{ .f = { 1, 2362, 3958, 10199 } }, // 222
+	{ .f = { 1, 2248, 6061, 10350 } }, // 223
+	{ .f = { 1, 2453, 5549, 10360 } }, // 224
+	{ .f = { 1, 2567, 4544, 10227 } }, // 225
+	{ .f = { 1, 1603, 5028, 10823 } }, // 226
+	{ .f = { 1, 1603, 4145, 8839 } }, // 227
+	{ .f = { 1, 1388, 3092, 10072 } }, // 228
+	{ .f = { 2, 737, 2457, 10072 } }, // 229
+	{ .f = { 1, 1388, 5345, 10072 } }, // 230
+	{ .f = { 2, 737, 6963, 10072 } }, // 231
+	{ .f = { 1, 1388, 4935, 8722 } }, // 232
+	{ .f = { 1, 1280, 2987, 10072 } }, // 233
+	{ .f = { 1, 1280, 5614, 10072 } }, // 234
+	{ .f = { 1, 1280, 5136, 8497 } }, // 235
+	{ .f = { 1, 1961, 6249, 11118 } }, // 236
+	{ .f = { 1, 2029, 4276, 9843 } }, // 237
+	{ .f = { 1, 1974, 7196, 11362 } }, // 238
+	{ .f = { 1, 2050, 4471, 10041 } }, // 239
+	{ .f = { 1, 2150, 6604, 10720 } }, // 240
+	{ .f = { 1, 2232, 4739, 10205 } }, // 241
+	{ .f = { 1, 2291, 4303, 10254 } }, // 242
+	{ .f = { 1, 2296, 5511, 10338 } }, // 243
+	{ .f = { 1, 1886, 5511, 8700 } }, // 244
+	{ .f = { 1, 2476, 6131, 10550 } }, // 245
+	{ .f = { 1, 2614, 4534, 10381 } }, // 246
+	{ .f = { 1, 2500, 6637, 10532 } }, // 247
+	{ .f = { 1, 2705, 6125, 10542 } }, // 248
+	{ .f = { 1, 2819, 5119, 10410 } }, // 249
+	{ .f = { 1, 1835, 5559, 10991 } }, // 250
+	{ .f = { 1, 1835, 4678, 9007 } }, // 251
+	{ .f = { 1, 1640, 3668, 10436 } }, // 252
+	{ .f = { 2, 737, 2457, 10436 } }, // 253
+	{ .f = { 1, 1640, 5920, 10436 } }, // 254
+	{ .f = { 2, 737, 6963, 10436 } }, // 255
+	{ .f = { 1, 1640, 5511, 8904 } }, // 256
+	{ .f = { 1, 1490, 3466, 10436 } }, // 257
+	{ .f = { 1, 1490, 6094, 10436 } }, // 258
+	{ .f = { 1, 1490, 5616, 8649 } }, // 259
+	{ .f = { 1, 1648, 7049, 10994 } }, // 260
+	{ .f = { 1, 1716, 5076, 9720 } }, // 261
+	{ .f = { 1, 1726, 7829, 11264 } }, // 262
+	{ .f = { 1, 1802, 5104, 9943 } }, // 263
+	{ .f = { 1, 1903, 7237, 10622 } }, // 264
+	{ .f = { 1, 1985, 5372, 10107 } }, // 265
+	{ .f = { 1, 1999, 7352, 10633 } }, // 266
+	{ .f = { 1, 2044, 4936, 10156 } }, // 267
+	{ .f = { 1, 2295, 5511, 10338 } }, // 268
+	{ .f = { 1, 1638, 6144, 8602 } }, // 269
+	{ .f = { 1, 2228, 6764, 10452 } }, // 270
+	{ .f = { 1, 2367, 5167, 10283 } }, // 271
+	{ .f = { 1, 2252, 7270, 10434 } }, // 272
+	{ .f = { 1, 2457, 6758, 10444 } }, // 273
+	{ .f = { 1, 2572, 5753, 10311 } }, // 274
+	{ .f = { 1, 1607, 6144, 10901 } }, // 275
+	{ .f = { 1, 1607, 5262, 8917 } }, // 276
+	{ .f = { 1, 1393, 4301, 10240 } }, // 277
+	{ .f = { 2, 737, 2457, 10240 } }, // 278
+	{ .f = { 1, 1393, 6553, 10240 } }, // 279
+	{ .f = { 2, 737, 6963, 10240 } }, // 280
+	{ .f = { 1, 1393, 6144, 8806 } }, // 281
+	{ .f = { 1, 1284, 3994, 10240 } }, // 282
+	{ .f = { 1, 1284, 6621, 10240 } }, // 283
+	{ .f = { 1, 1284, 6144, 8567 } }, // 284
+	{ .f = { 1, 1130, 7049, 8924 } }, // 285
+	{ .f = { 1, 1198, 5076, 7649 } }, // 286
+	{ .f = { 1, 1316, 7829, 9625 } }, // 287
+	{ .f = { 1, 1392, 5104, 8304 } }, // 288
+	{ .f = { 1, 1492, 7237, 8984 } }, // 289
+	{ .f = { 1, 1574, 5372, 8468 } }, // 290
+	{ .f = { 1, 1588, 7352, 8994 } }, // 291
+	{ .f = { 1, 1633, 4936, 8517 } }, // 292
+	{ .f = { 1, 1885, 5511, 8699 } }, // 293
+	{ .f = { 1, 1638, 6144, 8601 } }, // 294
+	{ .f = { 1, 1818, 6764, 8814 } }, // 295
+	{ .f = { 1, 1957, 5167, 8644 } }, // 296
+	{ .f = { 1, 1842, 7270, 8796 } }, // 297
+	{ .f = { 1, 2047, 6758, 8806 } }, // 298
+	{ .f = { 1, 2162, 5753, 8673 } }, // 299
+	{ .f = { 1, 1228, 6144, 9388 } }, // 300
+	{ .f = { 1, 1228, 5262, 7404 } }, // 301
+	{ .f = { 1, 983, 4301, 8304 } }, // 302
+	{ .f = { 1, 983, 6553, 8304 } }, // 303
+	{ .f = { 1, 983, 6144, 6554 } }, // 304
+	{ .f = { 2, 737, 6144, 6144 } }, // 305
+	{ .f = { 1, 942, 3994, 8528 } }, // 306
+	{ .f = { 1, 942, 6621, 8528 } }, // 307
+	{ .f = { 1, 942, 6144, 6486 } }, // 308
+	{ .f = { 1, 1876, 7833, 11262 } }, // 309
+	{ .f = { 1, 1944, 5860, 9988 } }, // 310
+	{ .f = { 1, 1906, 8450, 11476 } }, // 311
+	{ .f = { 1, 1982, 5724, 10156 } }, // 312
+	{ .f = { 1, 2083, 7858, 10835 } }, // 313
+	{ .f = { 1, 2165, 5992, 10319 } }, // 314
+	{ .f = { 1, 2179, 7972, 10845 } }, // 315
+	{ .f = { 1, 2224, 5556, 10369 } }, // 316
+	{ .f = { 1, 2475, 6132, 10551 } }, // 317
+	{ .f = { 1, 2228, 6765, 10453 } }, // 318
+	{ .f = { 1, 1818, 6765, 8814 } }, // 319
+	{ .f = { 1, 2547, 5788, 10496 } }, // 320
+	{ .f = { 1, 2432, 7890, 10647 } }, // 321
+	{ .f = { 1, 2637, 7379, 10657 } }, // 322
+	{ .f = { 1, 2752, 6373, 10524 } }, // 323
+	{ .f = { 1, 1773, 6717, 11097 } }, // 324
+	{ .f = { 1, 1773, 5835, 9113 } }, // 325
+	{ .f = { 1, 1573, 4921, 10665 } }, // 326
+	{ .f = { 2, 737, 2457, 10665 } }, // 327
+	{ .f = { 1, 1573, 7174, 10665 } }, // 328
+	{ .f = { 2, 737, 6963, 10665 } }, // 329
+	{ .f = { 1, 1573, 9017, 11271 } }, // 330
+	{ .f = { 1, 1434, 4511, 10665 } }, // 331
+	{ .f = { 1, 1434, 7139, 10665 } }, // 332
+	{ .f = { 1, 1434, 9289, 11372 } }, // 333
+	{ .f = { 1, 2051, 5815, 11048 } }, // 334
+	{ .f = { 1, 2119, 3842, 9774 } }, // 335
+	{ .f = { 1, 2045, 6852, 11307 } }, // 336
+	{ .f = { 1, 2121, 4127, 9986 } }, // 337
+	{ .f = { 1, 2222, 6260, 10665 } }, // 338
+	{ .f = { 1, 2304, 4394, 10150 } }, // 339
+	{ .f = { 1, 2318, 6375, 10676 } }, // 340
+	{ .f = { 1, 2363, 3959, 10199 } }, // 341
+	{ .f = { 1, 2615, 4534, 10381 } }, // 342
+	{ .f = { 1, 1957, 5167, 8645 } }, // 343
+	{ .f = { 1, 2547, 5787, 10495 } }, // 344
+	{ .f = { 1, 2572, 6293, 10477 } }, // 345
+	{ .f = { 1, 2776, 5781, 10487 } }, // 346
+	{ .f = { 1, 2891, 4775, 10354 } }, // 347
+	{ .f = { 1, 1901, 5242, 10940 } }, // 348
+	{ .f = { 1, 1901, 4359, 8957 } }, // 349
+	{ .f = { 1, 1712, 3324, 10326 } }, // 350
+	{ .f = { 2, 737, 2457, 10326 } }, // 351
+	{ .f = { 1, 1712, 5576, 10326 } }, // 352
+	{ .f = { 2, 737, 6963, 10326 } }, // 353
+	{ .f = { 1, 1712, 5167, 8849 } }, // 354
+	{ .f = { 1, 1550, 3180, 10326 } }, // 355
+	{ .f = { 1, 1550, 5807, 10326 } }, // 356
+	{ .f = { 1, 1550, 5329, 8603 } }, // 357
+	{ .f = { 1, 1907, 8471, 11240 } }, // 358
+	{ .f = { 1, 1974, 6498, 9965 } }, // 359
+	{ .f = { 1, 1931, 8955, 11458 } }, // 360
+	{ .f = { 1, 2007, 6230, 10138 } }, // 361
+	{ .f = { 1, 2107, 8364, 10817 } }, // 362
+	{ .f = { 1, 2189, 6498, 10301 } }, // 363
+	{ .f = { 1, 2203, 8478, 10827 } }, // 364
+	{ .f = { 1, 2248, 6062, 10351 } }, // 365
+	{ .f = { 1, 2500, 6637, 10533 } }, // 366
+	{ .f = { 1, 2253, 7270, 10435 } }, // 367
+	{ .f = { 1, 1843, 7270, 8796 } }, // 368
+	{ .f = { 1, 2433, 7891, 10647 } }, // 369
+	{ .f = { 1, 2571, 6293, 10478 } }, // 370
+	{ .f = { 1, 2662, 7884, 10639 } }, // 371
+	{ .f = { 1, 2776, 6879, 10506 } }, // 372
+	{ .f = { 1, 1796, 7184, 11080 } }, // 373
+	{ .f = { 1, 1796, 6301, 9096 } }, // 374
+	{ .f = { 1, 1597, 5427, 10629 } }, // 375
+	{ .f = { 2, 737, 2457, 10629 } }, // 376
+	{ .f = { 1, 1597, 7680, 10629 } }, // 377
+	{ .f = { 2, 737, 6963, 10629 } }, // 378
+	{ .f = { 1, 1597, 9522, 11253 } }, // 379
+	{ .f = { 1, 1454, 4932, 10629 } }, // 380
+	{ .f = { 1, 1454, 7561, 10629 } }, // 381
+	{ .f = { 1, 1454, 9710, 11357 } }, // 382
+	{ .f = { 1, 2166, 7824, 11252 } }, // 383
+	{ .f = { 1, 2233, 5852, 9978 } }, // 384
+	{ .f = { 1, 2136, 8443, 11468 } }, // 385
+	{ .f = { 1, 2212, 5718, 10148 } }, // 386
+	{ .f = { 1, 2312, 7851, 10827 } }, // 387
+	{ .f = { 1, 2394, 5986, 10311 } }, // 388
+	{ .f = { 1, 2408, 7966, 10837 } }, // 389
+	{ .f = { 1, 2453, 5550, 10361 } }, // 390
+	{ .f = { 1, 2705, 6125, 10543 } }, // 391
+	{ .f = { 1, 2458, 6758, 10445 } }, // 392
+	{ .f = { 1, 2048, 6758, 8806 } }, // 393
+	{ .f = { 1, 2638, 7378, 10657 } }, // 394
+	{ .f = { 1, 2777, 5781, 10488 } }, // 395
+	{ .f = { 1, 2981, 6367, 10516 } }, // 396
+	{ .f = { 1, 1985, 6711, 11090 } }, // 397
+	{ .f = { 1, 1985, 5829, 9106 } }, // 398
+	{ .f = { 1, 1536, 4915, 10649 } }, // 399
+	{ .f = { 2, 204, 2457, 10649 } }, // 400
+	{ .f = { 1, 1536, 7168, 10649 } }, // 401
+	{ .f = { 2, 204, 6963, 10649 } }, // 402
+	{ .f = { 1, 1536, 8806, 11058 } }, // 403
+	{ .f = { 2, 204, 10240, 11468 } }, // 404
+	{ .f = { 1, 1314, 4505, 10649 } }, // 405
+	{ .f = { 1, 1314, 7134, 10649 } }, // 406
+	{ .f = { 1, 1314, 9045, 11126 } }, // 407
+	{ .f = { 1, 2310, 6554, 11084 } }, // 408
+	{ .f = { 1, 2378, 4582, 9810 } }, // 409
+	{ .f = { 1, 2250, 7438, 11335 } }, // 410
+	{ .f = { 1, 2326, 4712, 10015 } }, // 411
+	{ .f = { 1, 2427, 6846, 10694 } }, // 412
+	{ .f = { 1, 2509, 4980, 10178 } }, // 413
+	{ .f = { 1, 2523, 6960, 10704 } }, // 414
+	{ .f = { 1, 2568, 4544, 10228 } }, // 415
+	{ .f = { 1, 2820, 5120, 10409 } }, // 416
+	{ .f = { 1, 2572, 5752, 10312 } }, // 417
+	{ .f = { 1, 2162, 5752, 8673 } }, // 418
+	{ .f = { 1, 2891, 4776, 10355 } }, // 419
+	{ .f = { 1, 2777, 6878, 10506 } }, // 420
+	{ .f = { 1, 2982, 6366, 10516 } }, // 421
+	{ .f = { 1, 2091, 5782, 10967 } }, // 422
+	{ .f = { 1, 2091, 4901, 8983 } }, // 423
+	{ .f = { 1, 1917, 3909, 10383 } }, // 424
+	{ .f = { 2, 737, 2457, 10383 } }, // 425
+	{ .f = { 1, 1917, 6162, 10383 } }, // 426
+	{ .f = { 2, 737, 6963, 10383 } }, // 427
+	{ .f = { 1, 1917, 7390, 10516 } }, // 428
+	{ .f = { 2, 737, 9420, 10649 } }, // 429
+	{ .f = { 1, 1720, 3667, 10383 } }, // 430
+	{ .f = { 1, 1720, 6295, 10383 } }, // 431
+	{ .f = { 1, 1720, 7728, 10538 } }, // 432
+	{ .f = { 1, 1140, 6963, 11741 } }, // 433
+	{ .f = { 1, 1201, 5178, 10588 } }, // 434
+	{ .f = { 1, 1309, 7699, 11846 } }, // 435
+	{ .f = { 1, 1379, 5184, 10628 } }, // 436
+	{ .f = { 1, 1472, 7153, 11255 } }, // 437
+	{ .f = { 1, 1547, 5431, 10778 } }, // 438
+	{ .f = { 1, 1560, 7259, 11264 } }, // 439
+	{ .f = { 1, 1602, 5029, 10824 } }, // 440
+	{ .f = { 1, 1834, 5560, 10992 } }, // 441
+	{ .f = { 1, 1606, 6144, 10902 } }, // 442
+	{ .f = { 1, 1228, 6144, 9389 } }, // 443
+	{ .f = { 1, 1772, 6716, 11098 } }, // 444
+	{ .f = { 1, 1900, 5243, 10941 } }, // 445
+	{ .f = { 1, 1795, 7183, 11081 } }, // 446
+	{ .f = { 1, 1984, 6710, 11090 } }, // 447
+	{ .f = { 1, 2090, 5783, 10968 } }, // 448
+	{ .f = { 1, 1228, 5325, 9625 } }, // 449
+	{ .f = { 1, 756, 4443, 11468 } }, // 450
+	{ .f = { 2, 204, 2457, 11468 } }, // 451
+	{ .f = { 1, 756, 6522, 11468 } }, // 452
+	{ .f = { 2, 204, 6963, 11468 } }, // 453
+	{ .f = { 1, 756, 7278, 10145 } }, // 454
+	{ .f = { 2, 204, 8601, 8601 } }, // 455
+	{ .f = { 1, 670, 4133, 11468 } }, // 456
+	{ .f = { 1, 670, 6590, 11468 } }, // 457
+	{ .f = { 1, 670, 7484, 9905 } }, // 458
+	{ .f = { 1, 1140, 5870, 9284 } }, // 459
+	{ .f = { 1, 1201, 4085, 8130 } }, // 460
+	{ .f = { 1, 1309, 6817, 9861 } }, // 461
+	{ .f = { 1, 1379, 4301, 8642 } }, // 462
+	{ .f = { 1, 1472, 6270, 9269 } }, // 463
+	{ .f = { 1, 1547, 4548, 8793 } }, // 464
+	{ .f = { 1, 1560, 6376, 9279 } }, // 465
+	{ .f = { 1, 1602, 4146, 8838 } }, // 466
+	{ .f = { 1, 1834, 4677, 9006 } }, // 467
+	{ .f = { 1, 1606, 5261, 8916 } }, // 468
+	{ .f = { 1, 1228, 5261, 7404 } }, // 469
+	{ .f = { 1, 1772, 5834, 9112 } }, // 470
+	{ .f = { 1, 1900, 4360, 8956 } }, // 471
+	{ .f = { 1, 1795, 6300, 9096 } }, // 472
+	{ .f = { 1, 1984, 5828, 9105 } }, // 473
+	{ .f = { 1, 2090, 4900, 8982 } }, // 474
+	{ .f = { 1, 1228, 5324, 9625 } }, // 475
+	{ .f = { 1, 662, 2426, 4191 } }, // 476
+	{ .f = { 1, 559, 2048, 3538 } }, // 477
+	{ .f = { 1, 737, 4096, 8192 } }, // 478
+	{ .f = { 1, 737, 2457, 12288 } }, // 479
+	{ .f = { 1, 819, 4720, 12288 } }, // 480
+	{ .f = { 1, 737, 2457, 9646 } }, // 481
+	{ .f = { 1, 887, 2746, 9344 } }, // 482
+	{ .f = { 1, 1070, 5986, 12288 } }, // 483
+	{ .f = { 1, 1146, 3260, 9646 } }, // 484
+	{ .f = { 1, 737, 2457, 11005 } }, // 485
+	{ .f = { 1, 737, 2457, 9973 } }, // 486
+	{ .f = { 1, 737, 2457, 11026 } }, // 487
+	{ .f = { 1, 1343, 5508, 11026 } }, // 488
+	{ .f = { 1, 737, 2457, 10072 } }, // 489
+	{ .f = { 1, 737, 2457, 10436 } }, // 490
+	{ .f = { 1, 1640, 3667, 10436 } }, // 491
+	{ .f = { 1, 737, 2457, 10240 } }, // 492
+	{ .f = { 1, 1392, 4300, 10240 } }, // 493
+	{ .f = { 1, 982, 4300, 8305 } }, // 494
+	{ .f = { 1, 737, 2457, 10665 } }, // 495
+	{ .f = { 1, 1572, 4921, 10665 } }, // 496
+	{ .f = { 1, 737, 2457, 10326 } }, // 497
+	{ .f = { 1, 1711, 3323, 10326 } }, // 498
+	{ .f = { 1, 737, 2457, 10629 } }, // 499
+	{ .f = { 1, 1597, 5426, 10629 } }, // 500
+	{ .f = { 1, 204, 2457, 10649 } }, // 501
+	{ .f = { 1, 1535, 4914, 10649 } }, // 502
+	{ .f = { 1, 737, 2457, 10383 } }, // 503
+	{ .f = { 1, 1916, 3909, 10383 } }, // 504
+	{ .f = { 1, 204, 2457, 11468 } }, // 505
+	{ .f = { 1, 755, 4442, 11468 } }, // 506
+	{ .f = { 1, 661, 2425, 4190 } }, // 507
+	{ .f = { 1, 737, 6963, 11059 } }, // 508
+	{ .f = { 1, 737, 6963, 12288 } }, // 509
+	{ .f = { 1, 819, 7566, 12288 } }, // 510
+	{ .f = { 1, 737, 6963, 9646 } }, // 511
+	{ .f = { 1, 887, 5593, 9344 } }, // 512
+	{ .f = { 1, 1070, 8239, 12288 } }, // 513
+	{ .f = { 1, 1146, 5513, 9646 } }, // 514
+	{ .f = { 1, 737, 6963, 11005 } }, // 515
+	{ .f = { 1, 737, 6963, 9973 } }, // 516
+	{ .f = { 1, 737, 6963, 11026 } }, // 517
+	{ .f = { 1, 1343, 7761, 11026 } }, // 518
+	{ .f = { 1, 737, 6963, 10072 } }, // 519
+	{ .f = { 1, 737, 6963, 10436 } }, // 520
+	{ .f = { 1, 1640, 5921, 10436 } }, // 521
+	{ .f = { 1, 737, 6963, 10240 } }, // 522
+	{ .f = { 1, 1392, 6554, 10240 } }, // 523
+	{ .f = { 1, 982, 6554, 8305 } }, // 524
+	{ .f = { 1, 737, 6963, 10665 } }, // 525
+	{ .f = { 1, 1572, 7174, 10665 } }, // 526
+	{ .f = { 1, 737, 6963, 10326 } }, // 527
+	{ .f = { 1, 1711, 5577, 10326 } }, // 528
+	{ .f = { 1, 737, 6963, 10629 } }, // 529
+	{ .f = { 1, 1597, 7679, 10629 } }, // 530
+	{ .f = { 1, 204, 6963, 10649 } }, // 531
+	{ .f = { 1, 1535, 7167, 10649 } }, // 532
+	{ .f = { 1, 737, 6963, 10383 } }, // 533
+	{ .f = { 1, 1916, 6162, 10383 } }, // 534
+	{ .f = { 1, 204, 6963, 11468 } }, // 535
+	{ .f = { 1, 755, 6522, 11468 } }, // 536
+	{ .f = { 1, 737, 9420, 0 } }, // 537
+	{ .f = { 1, 737, 11059, 12288 } }, // 538
+	{ .f = { 1, 819, 10154, 12288 } }, // 539
+	{ .f = { 1, 737, 6144, 7372 } }, // 540
+	{ .f = { 1, 887, 5076, 7907 } }, // 541
+	{ .f = { 1, 1070, 10287, 12288 } }, // 542
+	{ .f = { 1, 1146, 5104, 8509 } }, // 543
+	{ .f = { 1, 737, 10649, 11878 } }, // 544
+	{ .f = { 1, 1247, 9490, 11442 } }, // 545
+	{ .f = { 1, 1329, 5372, 8672 } }, // 546
+	{ .f = { 1, 1343, 9605, 11452 } }, // 547
+	{ .f = { 1, 1388, 4936, 8722 } }, // 548
+	{ .f = { 1, 1392, 6144, 8806 } }, // 549
+	{ .f = { 1, 737, 6144, 6144 } }, // 550
+	{ .f = { 1, 982, 6144, 6553 } }, // 551
+	{ .f = { 1, 1572, 9017, 11272 } }, // 552
+	{ .f = { 1, 1711, 5167, 8849 } }, // 553
+	{ .f = { 1, 1597, 9523, 11254 } }, // 554
+	{ .f = { 1, 204, 10240, 11468 } }, // 555
+	{ .f = { 1, 1535, 8806, 11059 } }, // 556
+	{ .f = { 1, 737, 9420, 10649 } }, // 557
+	{ .f = { 1, 1916, 7391, 10516 } }, // 558
+	{ .f = { 1, 204, 8601, 8601 } }, // 559
+	{ .f = { 1, 755, 7278, 10144 } }, // 560
+	{ .f = { 1, 1228, 2048, 3686 } }, // 561
+	{ .f = { 1, 803, 4264, 12288 } }, // 562
+	{ .f = { 1, 857, 2688, 9405 } }, // 563
+	{ .f = { 1, 1014, 5397, 12288 } }, // 564
+	{ .f = { 1, 1078, 3126, 9646 } }, // 565
+	{ .f = { 1, 1162, 4904, 11005 } }, // 566
+	{ .f = { 1, 1230, 3349, 9973 } }, // 567
+	{ .f = { 1, 1242, 4999, 11026 } }, // 568
+	{ .f = { 1, 1279, 2986, 10072 } }, // 569
+	{ .f = { 1, 1489, 3465, 10436 } }, // 570
+	{ .f = { 1, 1283, 3993, 10240 } }, // 571
+	{ .f = { 1, 941, 3993, 8529 } }, // 572
+	{ .f = { 1, 1433, 4510, 10665 } }, // 573
+	{ .f = { 1, 1549, 3179, 10326 } }, // 574
+	{ .f = { 1, 1453, 4931, 10629 } }, // 575
+	{ .f = { 1, 1313, 4504, 10649 } }, // 576
+	{ .f = { 1, 1719, 3667, 10383 } }, // 577
+	{ .f = { 1, 669, 4132, 11468 } }, // 578
+	{ .f = { 1, 558, 2047, 3537 } }, // 579
+	{ .f = { 0, 2048, 2048, 2048 } }, // 580
+	{ .f = { 1, 803, 7444, 12288 } }, // 581
+	{ .f = { 1, 857, 5870, 9405 } }, // 582
+	{ .f = { 1, 1014, 8026, 12288 } }, // 583
+	{ .f = { 1, 1078, 5755, 9646 } }, // 584
+	{ .f = { 1, 1230, 5978, 9973 } }, // 585
+	{ .f = { 1, 1242, 7628, 11026 } }, // 586
+	{ .f = { 1, 1279, 5615, 10072 } }, // 587
+	{ .f = { 1, 1489, 6095, 10436 } }, // 588
+	{ .f = { 1, 1283, 6622, 10240 } }, // 589
+	{ .f = { 1, 941, 6622, 8529 } }, // 590
+	{ .f = { 1, 1433, 7138, 10665 } }, // 591
+	{ .f = { 1, 1549, 5808, 10326 } }, // 592
+	{ .f = { 1, 1453, 7560, 10629 } }, // 593
+	{ .f = { 1, 1313, 7133, 10649 } }, // 594
+	{ .f = { 1, 1719, 6296, 10383 } }, // 595
+	{ .f = { 1, 669, 6591, 11468 } }, // 596
+	{ .f = { 0, 16384, 16384, 16384 } }, // 597
+	{ .f = { 1, 803, 10337, 12288 } }, // 598
+	{ .f = { 1, 857, 5292, 7799 } }, // 599
+	{ .f = { 1, 1014, 10416, 12288 } }, // 600
+	{ .f = { 1, 1078, 5277, 8319 } }, // 601
+	{ .f = { 1, 1162, 9684, 11515 } }, // 602
+	{ .f = { 1, 1230, 5501, 8455 } }, // 603
+	{ .f = { 1, 1242, 9779, 11523 } }, // 604
+	{ .f = { 1, 1279, 5137, 8497 } }, // 605
+	{ .f = { 1, 1489, 5617, 8648 } }, // 606
+	{ .f = { 1, 1283, 6144, 8567 } }, // 607
+	{ .f = { 1, 941, 6144, 6485 } }, // 608
+	{ .f = { 1, 1433, 9289, 11373 } }, // 609
+	{ .f = { 1, 1549, 5330, 8602 } }, // 610
+	{ .f = { 1, 1453, 9711, 11358 } }, // 611
+	{ .f = { 1, 1313, 9045, 11127 } }, // 612
+	{ .f = { 1, 1719, 7729, 10539 } }, // 613
+	{ .f = { 1, 669, 7485, 9904 } }, // 614
+	{ .f = { 0, 4915, 4915, 4915 } }, // 615
+	{ .f = { 0, 3481, 4915, 0 } }, // 616
+	{ .f = { 1, 3481, 4915, 0 } }, // 617
+	{ .f = { 0, 16384, 24576, 28672 } }, // 618
+	{ .f = { 1, 16384, 24576, 28672 } }, // 619
+	{ .f = { 0, 10240, 19660, 26214 } }, // 620
+	{ .f = { 1, 10240, 19660, 26214 } }, // 621
+	{ .f = { 0, 22528, 0, 0 } }, // 622
+	{ .f = { 1, 22528, 0, 0 } }, // 623
+};
+
+const struct diphone_table_segment diphone_nuclei[N_PHONEME] PROGMEM = {
+	[0] = { 0, 0, 10, 0 },
+	[1] = { 1, 1, 7, 3 },
+	[2] = { 3, 3, 7, 3 },
+	[3] = { 5, 5, 12, 3 },
+	[4] = { 7, 7, 12, 3 },
+	[5] = { 9, 9, 12, 3 },
+	[6] = { 11, 11, 12, 3 },
+	[7] = { 13, 13, 12, 3 },
+	[8] = { 15, 15, 12, 3 },
+	[9] = { 17, 17, 12, 3 },
+	[10] = { 19, 19, 12, 3 },
+	[11] = { 21, 21, 12, 3 },
+	[12] = { 23, 23, 12, 3 },
+	[13] = { 25, 25, 12, 3 },
+	[14] = { 27, 27, 12, 3 },
+	[15] = { 29, 29, 12, 3 },
+	[16] = { 31, 31, 12, 3 },
+	[17] = { 33, 33, 25, 3 },
+	[18] = { 35, 35, 25, 3 },
+	[19] = { 478, 478, 15, 3 },
+	[20] = { 508, 508, 15, 3 },
+	[21] = { 537, 537, 15, 3 },
+	[22] = { 561, 561, 7, 0 },
+	[23] = { 580, 580, 7, 2 },
+	[24] = { 561, 561, 7, 0 },
+	[25] = { 597, 597, 7, 2 },
+	[26] = { 561, 561, 7, 0 },
+	[27] = { 615, 615, 7, 2 },
+	[28] = { 616, 616, 27, 2 },
+	[29] = { 617, 617, 27, 2 },
+	[30] = { 618, 618, 27, 2 },
+	[31] = { 619, 619, 27, 2 },
+	[32] = { 620, 620, 27, 2 },
+	[33] = { 621, 621, 27, 2 },
+	[34] = { 622, 622, 27, 2 },
+	[35] = { 623, 623, 27, 2 },
+	[36] = { 0, 0, 0, 0 },
+};
+
+const struct diphone_table_transition diphone_transitions[N_PHONEME][N_PHONEME] PROGMEM = {
+	[0] = {
+		[0] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[1] = { { 0, 0, 0, 0 }, { 1, 2, 12, 3 } },
+		[2] = { { 0, 0, 0, 0 }, { 3, 4, 12, 3 } },
+		[3] = { { 0, 0, 0, 0 }, { 5, 6, 7, 3 } },
+		[4] = { { 0, 0, 0, 0 }, { 7, 8, 7, 3 } },
+		[5] = { { 0, 0, 0, 0 }, { 9, 10, 7, 3 } },
+		[6] = { { 0, 0, 0, 0 }, { 11, 12, 7, 3 } },
+		[7] = { { 0, 0, 0, 0 }, { 13, 14, 7, 3 } },
+		[8] = { { 0, 0, 0, 0 }, { 15, 16, 7, 3 } },
+		[9] = { { 0, 0, 0, 0 }, { 17, 18, 7, 3 } },
+		[10] = { { 0, 0, 0, 0 }, { 19, 20, 7, 3 } },
+		[11] = { { 0, 0, 0, 0 }, { 21, 22, 7, 3 } },
+		[12] = { { 0, 0, 0, 0 }, { 23, 24, 7, 3 } },
+		[13] = { { 0, 0, 0, 0 }, { 25, 26, 7, 3 } },
+		[14] = { { 0, 0, 0, 0 }, { 27, 28, 7, 3 } },
+		[15] = { { 0, 0, 0, 0 }, { 29, 30, 7, 3 } },
+		[16] = { { 0, 0, 0, 0 }, { 31, 32, 7, 3 } },
+		[17] = { { 0, 0, 0, 0 }, { 33, 34, 6, 3 } },
+		[18] = { { 0, 0, 0, 0 }, { 35, 36, 6, 3 } },
+		[19] = { { 0, 0, 0, 0 }, { 37, 38, 7, 3 } },
+		[20] = { { 0, 0, 0, 0 }, { 37, 38, 7, 3 } },
+		[21] = { { 0, 0, 0, 0 }, { 37, 38, 7, 3 } },
+		[22] = { { 0, 0, 0, 0 }, { 37, 38, 5, 3 } },
+		[23] = { { 0, 0, 0, 0 }, { 37, 38, 7, 0 } },
+		[24] = { { 0, 0, 0, 0 }, { 37, 38, 5, 3 } },
+		[25] = { { 0, 0, 0, 0 }, { 37, 38, 7, 0 } },
+		[26] = { { 0, 0, 0, 0 }, { 37, 38, 5, 3 } },
+		[27] = { { 0, 0, 0, 0 }, { 37, 38, 7, 0 } },
+		[28] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[29] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[30] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[31] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[32] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[33] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[34] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[35] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[36] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+	},
+	[1] = {
+		[0] = { { 1, 1, 12, 3 }, { 0, 0, 0, 0 } },
+		[1] = { { 1, 1, 12, 3 }, { 1, 2, 12, 3 } },
+		[2] = { { 1, 39, 12, 3 }, { 39, 4, 12, 3 } },
+		[3] = { { 1, 40, 12, 3 }, { 40, 6, 7, 3 } },
+		[4] = { { 1, 41, 12, 3 }, { 41, 8, 7, 3 } },
+		[5] = { { 1, 42, 12, 3 }, { 42, 10, 7, 3 } },
+		[6] = { { 1, 43, 12, 3 }, { 43, 12, 7, 3 } },
+		[7] = { { 1, 44, 12, 3 }, { 44, 14, 7, 3 } },
+		[8] = { { 1, 45, 12, 3 }, { 45, 16, 7, 3 } },
+		[9] = { { 1, 46, 12, 3 }, { 46, 18, 7, 3 } },
+		[10] = { { 1, 47, 12, 3 }, { 47, 20, 7, 3 } },
+		[11] = { { 1, 48, 12, 3 }, { 48, 22, 7, 3 } },
+		[12] = { { 1, 49, 12, 3 }, { 49, 24, 7, 3 } },
+		[13] = { { 1, 50, 12, 3 }, { 50, 26, 7, 3 } },
+		[14] = { { 1, 51, 12, 3 }, { 51, 28, 7, 3 } },
+		[15] = { { 1, 52, 12, 3 }, { 52, 30, 7, 3 } },
+		[16] = { { 1, 53, 12, 3 }, { 53, 32, 7, 3 } },
+		[17] = { { 1, 54, 12, 3 }, { 54, 34, 6, 3 } },
+		[18] = { { 1, 55, 12, 3 }, { 55, 36, 6, 3 } },
+		[19] = { { 1, 56, 12, 3 }, { 56, 57, 7, 3 } },
+		[20] = { { 1, 58, 12, 3 }, { 58, 59, 7, 3 } },
+		[21] = { { 1, 60, 12, 3 }, { 60, 61, 7, 3 } },
+		[22] = { { 1, 62, 12, 3 }, { 62, 57, 5, 3 } },
+		[23] = { { 1, 56, 12, 3 }, { 56, 57, 7, 0 } },
+		[24] = { { 1, 63, 12, 3 }, { 63, 59, 5, 3 } },
+		[25] = { { 1, 58, 12, 3 }, { 58, 59, 7, 0 } },
+		[26] = { { 1, 64, 12, 3 }, { 64, 61, 5, 3 } },
+		[27] = { { 1, 60, 12, 3 }, { 60, 61, 7, 0 } },
+		[28] = { { 1, 1, 12, 3 }, { 0, 0, 0, 0 } },
+		[29] = { { 1, 1, 12, 3 }, { 0, 0, 0, 0 } },
+		[30] = { { 1, 1, 12, 3 }, { 0, 0, 0, 0 } },
+		[31] = { { 1, 1, 12, 3 }, { 0, 0, 0, 0 } },
+		[32] = { { 1, 1, 12, 3 }, { 0, 0, 0, 0 } },
+		[33] = { { 1, 1, 12, 3 }, { 0, 0, 0, 0 } },
+		[34] = { { 1, 1, 12, 3 }, { 0, 0, 0, 0 } },
+		[35] = { { 1, 1, 12, 3 }, { 0, 0, 0, 0 } },
+		[36] = { { 1, 1, 12, 3 }, { 0, 0, 0, 0 } },
+	},
+	[2] = {
+		[0] = { { 3, 3, 12, 3 }, { 0, 0, 0, 0 } },
+		[1] = { { 3, 65, 12, 3 }, { 65, 2, 12, 3 } },
+		[2] = { { 3, 3, 12, 3 }, { 3, 4, 12, 3 } },
+		[3] = { { 3, 66, 12, 3 }, { 66, 6, 7, 3 } },
+		[4] = { { 3, 67, 12, 3 }, { 67, 8, 7, 3 } },
+		[5] = { { 3, 68, 12, 3 }, { 68, 10, 7, 3 } },
+		[6] = { { 3, 69, 12, 3 }, { 69, 12, 7, 3 } },
+		[7] = { { 3, 70, 12, 3 }, { 70, 14, 7, 3 } },
+		[8] = { { 3, 71, 12, 3 }, { 71, 16, 7, 3 } },
+		[9] = { { 3, 72, 12, 3 }, { 72, 18, 7, 3 } },
+		[10] = { { 3, 73, 12, 3 }, { 73, 20, 7, 3 } },
+		[11] = { { 3, 74, 12, 3 }, { 74, 22, 7, 3 } },
+		[12] = { { 3, 75, 12, 3 }, { 75, 24, 7, 3 } },
+		[13] = { { 3, 76, 12, 3 }, { 76, 26, 7, 3 } },
+		[14] = { { 3, 77, 12, 3 }, { 77, 28, 7, 3 } },
+		[15] = { { 3, 78, 12, 3 }, { 78, 30, 7, 3 } },
+		[16] = { { 3, 79, 12, 3 }, { 79, 32, 7, 3 } },
+		[17] = { { 3, 80, 12, 3 }, { 80, 34, 6, 3 } },
+		[18] = { { 3, 81, 12, 3 }, { 81, 36, 6, 3 } },
+		[19] = { { 3, 82, 12, 3 }, { 82, 83, 7, 3 } },
+		[20] = { { 3, 84, 12, 3 }, { 84, 85, 7, 3 } },
+		[21] = { { 3, 86, 12, 3 }, { 86, 87, 7, 3 } },
+		[22] = { { 3, 88, 12, 3 }, { 88, 83, 5, 3 } },
+		[23] = { { 3, 82, 12, 3 }, { 82, 83, 7, 0 } },
+		[24] = { { 3, 89, 12, 3 }, { 89, 85, 5, 3 } },
+		[25] = { { 3, 84, 12, 3 }, { 84, 85, 7, 0 } },
+		[26] = { { 3, 90, 12, 3 }, { 90, 87, 5, 3 } },
+		[27] = { { 3, 86, 12, 3 }, { 86, 87, 7, 0 } },
+		[28] = { { 3, 3, 12, 3 }, { 0, 0, 0, 0 } },
+		[29] = { { 3, 3, 12, 3 }, { 0, 0, 0, 0 } },
+		[30] = { { 3, 3, 12, 3 }, { 0, 0, 0, 0 } },
+		[31] = { { 3, 3, 12, 3 }, { 0, 0, 0, 0 } },
+		[32] = { { 3, 3, 12, 3 }, { 0, 0, 0, 0 } },
+		[33] = { { 3, 3, 12, 3 }, { 0, 0, 0, 0 } },
+		[34] = { { 3, 3, 12, 3 }, { 0, 0, 0, 0 } },
+		[35] = { { 3, 3, 12, 3 }, { 0, 0, 0, 0 } },
+		[36] = { { 3, 3, 12, 3 }, { 0, 0, 0, 0 } },
+	},
+	[3] = {
+		[0] = { { 5, 5, 7, 3 }, { 0, 0, 0, 0 } },
+		[1] = { { 5, 91, 7, 3 }, { 91, 2, 12, 3 } },
+		[2] = { { 5, 92, 7, 3 }, { 92, 4, 12, 3 } },
+		[3] = { { 5, 5, 7, 3 }, { 5, 6, 7, 3 } },
+		[4] = { { 5, 93, 7, 3 }, { 93, 8, 7, 3 } },
+		[5] = { { 5, 94, 7, 3 }, { 94, 10, 7, 3 } },
+		[6] = { { 5, 95, 7, 3 }, { 95, 12, 7, 3 } },
+		[7] = { { 5, 96, 7, 3 }, { 96, 14, 7, 3 } },
+		[8] = { { 5, 97, 7, 3 }, { 97, 16, 7, 3 } },
+		[9] = { { 5, 98, 7, 3 }, { 98, 18, 7, 3 } },
+		[10] = { { 5, 99, 7, 3 }, { 99, 20, 7, 3 } },
+		[11] = { { 5, 100, 7, 3 }, { 100, 22, 7, 3 } },
+		[12] = { { 5, 101, 7, 3 }, { 101, 24, 7, 3 } },
+		[13] = { { 5, 102, 7, 3 }, { 102, 26, 7, 3 } },
+		[14] = { { 5, 103, 7, 3 }, { 103, 28, 7, 3 } },
+		[15] = { { 5, 104, 7, 3 }, { 104, 30, 7, 3 } },
+		[16] = { { 5, 105, 7, 3 }, { 105, 32, 7, 3 } },
+		[17] = { { 5, 106, 7, 3 }, { 106, 34, 6, 3 } },
+		[18] = { { 5, 107, 7, 3 }, { 107, 36, 6, 3 } },
+		[19] = { { 5, 108, 7, 3 }, { 108, 57, 7, 3 } },
+		[20] = { { 5, 109, 7, 3 }, { 109, 59, 7, 3 } },
+		[21] = { { 5, 110, 7, 3 }, { 110, 61, 7, 3 } },
+		[22] = { { 5, 111, 7, 3 }, { 111, 57, 5, 3 } },
+		[23] = { { 5, 108, 7, 3 }, { 108, 57, 7, 0 } },
+		[24] = { { 5, 112, 7, 3 }, { 112, 59, 5, 3 } },
+		[25] = { { 5, 109, 7, 3 }, { 109, 59, 7, 0 } },
+		[26] = { { 5, 113, 7, 3 }, { 113, 61, 5, 3 } },
+		[27] = { { 5, 110, 7, 3 }, { 110, 61, 7, 0 } },
+		[28] = { { 5, 5, 7, 3 }, { 0, 0, 0, 0 } },
+		[29] = { { 5, 5, 7, 3 }, { 0, 0, 0, 0 } },
+		[30] = { { 5, 5, 7, 3 }, { 0, 0, 0, 0 } },
+		[31] = { { 5, 5, 7, 3 }, { 0, 0, 0, 0 } },
+		[32] = { { 5, 5, 7, 3 }, { 0, 0, 0, 0 } },
+		[33] = { { 5, 5, 7, 3 }, { 0, 0, 0, 0 } },
+		[34] = { { 5, 5, 7, 3 }, { 0, 0, 0, 0 } },
+		[35] = { { 5, 5, 7, 3 }, { 0, 0, 0, 0 } },
+		[36] = { { 5, 5, 7, 3 }, { 0, 0, 0, 0 } },
+	},
+	[4] = {
+		[0] = { { 7, 7, 7, 3 }, { 0, 0, 0, 0 } },
+		[1] = { { 7, 114, 7, 3 }, { 114, 2, 12, 3 } },
+		[2] = { { 7, 115, 7, 3 }, { 115, 4, 12, 3 } },
+		[3] = { { 7, 93, 7, 3 }, { 93, 6, 7, 3 } },
+		[4] = { { 7, 7, 7, 3 }, { 7, 8, 7, 3 } },
+		[5] = { { 7, 116, 7, 3 }, { 116, 10, 7, 3 } },
+		[6] = { { 7, 117, 7, 3 }, { 117, 12, 7, 3 } },
+		[7] = { { 7, 118, 7, 3 }, { 118, 14, 7, 3 } },
+		[8] = { { 7, 119, 7, 3 }, { 119, 16, 7, 3 } },
+		[9] = { { 7, 120, 7, 3 }, { 120, 18, 7, 3 } },
+		[10] = { { 7, 121, 7, 3 }, { 121, 20, 7, 3 } },
+		[11] = { { 7, 122, 7, 3 }, { 122, 22, 7, 3 } },
+		[12] = { { 7, 123, 7, 3 }, { 123, 24, 7, 3 } },
+		[13] = { { 7, 124, 7, 3 }, { 124, 26, 7, 3 } },
+		[14] = { { 7, 125, 7, 3 }, { 125, 28, 7, 3 } },
+		[15] = { { 7, 126, 7, 3 }, { 126, 30, 7, 3 } },
+		[16] = { { 7, 127, 7, 3 }, { 127, 32, 7, 3 } },
+		[17] = { { 7, 128, 7, 3 }, { 128, 34, 6, 3 } },
+		[18] = { { 7, 129, 7, 3 }, { 129, 36, 6, 3 } },
+		[19] = { { 7, 130, 7, 3 }, { 130, 83, 7, 3 } },
+		[20] = { { 7, 131, 7, 3 }, { 131, 85, 7, 3 } },
+		[21] = { { 7, 132, 7, 3 }, { 132, 87, 7, 3 } },
+		[22] = { { 7, 133, 7, 3 }, { 133, 83, 5, 3 } },
+		[23] = { { 7, 130, 7, 3 }, { 130, 83, 7, 0 } },
+		[24] = { { 7, 134, 7, 3 }, { 134, 85, 5, 3 } },
+		[25] = { { 7, 131, 7, 3 }, { 131, 85, 7, 0 } },
+		[26] = { { 7, 135, 7, 3 }, { 135, 87, 5, 3 } },
+		[27] = { { 7, 132, 7, 3 }, { 132, 87, 7, 0 } },
+		[28] = { { 7, 7, 7, 3 }, { 0, 0, 0, 0 } },
+		[29] = { { 7, 7, 7, 3 }, { 0, 0, 0, 0 } },
+		[30] = { { 7, 7, 7, 3 }, { 0, 0, 0, 0 } },
+		[31] = { { 7, 7, 7, 3 }, { 0, 0, 0, 0 } },
+		[32] = { { 7, 7, 7, 3 }, { 0, 0, 0, 0 } },
+		[33] = { { 7, 7, 7, 3 }, { 0, 0, 0, 0 } },
+		[34] = { { 7, 7, 7, 3 }, { 0, 0, 0, 0 } },
+		[35] = { { 7, 7, 7, 3 }, { 0, 0, 0, 0 } },
+		[36] = { { 7, 7, 7, 3 }, { 0, 0, 0, 0 } },
+	},
+	[5] = {
+		[0] = { { 9, 9, 7, 3 }, { 0, 0, 0, 0 } },
+		[1] = { { 9, 136, 7, 3 }, { 136, 2, 12, 3 } },
+		[2] = { { 9, 137, 7, 3 }, { 137, 4, 12, 3 } },
+		[3] = { { 9, 138, 7, 3 }, { 138, 6, 7, 3 } },
+		[4] = { { 9, 139, 7, 3 }, { 139, 8, 7, 3 } },
+		[5] = { { 9, 9, 7, 3 }, { 9, 10, 7, 3 } },
+		[6] = { { 9, 140, 7, 3 }, { 140, 12, 7, 3 } },
+		[7] = { { 9, 141, 7, 3 }, { 141, 14, 7, 3 } },
+		[8] = { { 9, 142, 7, 3 }, { 142, 16, 7, 3 } },
+		[9] = { { 9, 143, 7, 3 }, { 143, 18, 7, 3 } },
+		[10] = { { 9, 144, 7, 3 }, { 144, 20, 7, 3 } },
+		[11] = { { 9, 145, 7, 3 }, { 145, 22, 7, 3 } },
+		[12] = { { 9, 146, 7, 3 }, { 146, 24, 7, 3 } },
+		[13] = { { 9, 147, 7, 3 }, { 147, 26, 7, 3 } },
+		[14] = { { 9, 148, 7, 3 }, { 148, 28, 7, 3 } },
+		[15] = { { 9, 149, 7, 3 }, { 149, 30, 7, 3 } },
+		[16] = { { 9, 150, 7, 3 }, { 150, 32, 7, 3 } },
+		[17] = { { 9, 151, 7, 3 }, { 151, 34, 6, 3 } },
+		[18] = { { 9, 152, 7, 3 }, { 152, 36, 6, 3 } },
+		[19] = { { 9, 153, 7, 3 }, { 153, 154, 7, 3 } },
+		[20] = { { 9, 155, 7, 3 }, { 155, 156, 7, 3 } },
+		[21] = { { 9, 157, 7, 3 }, { 157, 158, 7, 3 } },
+		[22] = { { 9, 159, 7, 3 }, { 159, 154, 5, 3 } },
+		[23] = { { 9, 153, 7, 3 }, { 153, 154, 7, 0 } },
+		[24] = { { 9, 160, 7, 3 }, { 160, 156, 5, 3 } },
+		[25] = { { 9, 155, 7, 3 }, { 155, 156, 7, 0 } },
+		[26] = { { 9, 161, 7, 3 }, { 161, 158, 5, 3 } },
+		[27] = { { 9, 157, 7, 3 }, { 157, 158, 7, 0 } },
+		[28] = { { 9, 9, 7, 3 }, { 0, 0, 0, 0 } },
+		[29] = { { 9, 9, 7, 3 }, { 0, 0, 0, 0 } },
+		[30] = { { 9, 9, 7, 3 }, { 0, 0, 0, 0 } },
+		[31] = { { 9, 9, 7, 3 }, { 0, 0, 0, 0 } },
+		[32] = { { 9, 9, 7, 3 }, { 0, 0, 0, 0 } },
+		[33] = { { 9, 9, 7, 3 }, { 0, 0, 0, 0 } },
+		[34] = { { 9, 9, 7, 3 }, { 0, 0, 0, 0 } },
+		[35] = { { 9, 9, 7, 3 }, { 0, 0, 0, 0 } },
+		[36] = { { 9, 9, 7, 3 }, { 0, 0, 0, 0 } },
+	},
+	[6] = {
+		[0] = { { 11, 11, 7, 3 }, { 0, 0, 0, 0 } },
+		[1] = { { 11, 162, 7, 3 }, { 162, 2, 12, 3 } },
+		[2] = { { 11, 163, 7, 3 }, { 163, 4, 12, 3 } },
+		[3] = { { 11, 164, 7, 3 }, { 164, 6, 7, 3 } },
+		[4] = { { 11, 165, 7, 3 }, { 165, 8, 7, 3 } },
+		[5] = { { 11, 140, 7, 3 }, { 140, 10, 7, 3 } },
+		[6] = { { 11, 11, 7, 3 }, { 11, 12, 7, 3 } },
+		[7] = { { 11, 166, 7, 3 }, { 166, 14, 7, 3 } },
+		[8] = { { 11, 167, 7, 3 }, { 167, 16, 7, 3 } },
+		[9] = { { 11, 168, 7, 3 }, { 168, 18, 7, 3 } },
+		[10] = { { 11, 169, 7, 3 }, { 169, 20, 7, 3 } },
+		[11] = { { 11, 170, 7, 3 }, { 170, 22, 7, 3 } },
+		[12] = { { 11, 171, 7, 3 }, { 171, 24, 7, 3 } },
+		[13] = { { 11, 172, 7, 3 }, { 172, 26, 7, 3 } },
+		[14] = { { 11, 173, 7, 3 }, { 173, 28, 7, 3 } },
+		[15] = { { 11, 174, 7, 3 }, { 174, 30, 7, 3 } },
+		[16] = { { 11, 175, 7, 3 }, { 175, 32, 7, 3 } },
+		[17] = { { 11, 176, 7, 3 }, { 176, 34, 6, 3 } },
+		[18] = { { 11, 177, 7, 3 }, { 177, 36, 6, 3 } },
+		[19] = { { 11, 178, 7, 3 }, { 178, 179, 7, 3 } },
+		[20] = { { 11, 180, 7, 3 }, { 180, 181, 7, 3 } },
+		[21] = { { 11, 182, 7, 3 }, { 182, 87, 7, 3 } },
+		[22] = { { 11, 183, 7, 3 }, { 183, 179, 5, 3 } },
+		[23] = { { 11, 178, 7, 3 }, { 178, 179, 7, 0 } },
+		[24] = { { 11, 184, 7, 3 }, { 184, 181, 5, 3 } },
+		[25] = { { 11, 180, 7, 3 }, { 180, 181, 7, 0 } },
+		[26] = { { 11, 185, 7, 3 }, { 185, 87, 5, 3 } },
+		[27] = { { 11, 182, 7, 3 }, { 182, 87, 7, 0 } },
+		[28] = { { 11, 11, 7, 3 }, { 0, 0, 0, 0 } },
+		[29] = { { 11, 11, 7, 3 }, { 0, 0, 0, 0 } },
+		[30] = { { 11, 11, 7, 3 }, { 0, 0, 0, 0 } },
+		[31] = { { 11, 11, 7, 3 }, { 0, 0, 0, 0 } },
+		[32] = { { 11, 11, 7, 3 }, { 0, 0, 0, 0 } },
+		[33] = { { 11, 11, 7, 3 }, { 0, 0, 0, 0 } },
+		[34] = { { 11, 11, 7, 3 }, { 0, 0, 0, 0 } },
+		[35] = { { 11, 11, 7, 3 }, { 0, 0, 0, 0 } },
+		[36] = { { 11, 11, 7, 3 }, { 0, 0, 0, 0 } },
+	},
+	[7] = {
+		[0] = { { 13, 13, 7, 3 }, { 0, 0, 0, 0 } },
+		[1] = { { 13, 186, 7, 3 }, { 186, 2, 12, 3 } },
+		[2] = { { 13, 187, 7, 3 }, { 187, 4, 12, 3 } },
+		[3] = { { 13, 188, 7, 3 }, { 188, 6, 7, 3 } },
+		[4] = { { 13, 189, 7, 3 }, { 189, 8, 7, 3 } },
+		[5] = { { 13, 190, 7, 3 }, { 190, 10, 7, 3 } },
+		[6] = { { 13, 191, 7, 3 }, { 191, 12, 7, 3 } },
+		[7] = { { 13, 13, 7, 3 }, { 13, 14, 7, 3 } },
+		[8] = { { 13, 192, 7, 3 }, { 192, 16, 7, 3 } },
+		[9] = { { 13, 193, 7, 3 }, { 193, 18, 7, 3 } },
+		[10] = { { 13, 194, 7, 3 }, { 194, 20, 7, 3 } },
+		[11] = { { 13, 195, 7, 3 }, { 195, 22, 7, 3 } },
+		[12] = { { 13, 196, 7, 3 }, { 196, 24, 7, 3 } },
+		[13] = { { 13, 197, 7, 3 }, { 197, 26, 7, 3 } },
+		[14] = { { 13, 198, 7, 3 }, { 198, 28, 7, 3 } },
+		[15] = { { 13, 199, 7, 3 }, { 199, 30, 7, 3 } },
+		[16] = { { 13, 200, 7, 3 }, { 200, 32, 7, 3 } },
+		[17] = { { 13, 201, 7, 3 }, { 201, 34, 6, 3 } },
+		[18] = { { 13, 202, 7, 3 }, { 202, 36, 6, 3 } },
+		[19] = { { 13, 203, 7, 3 }, { 203, 204, 7, 3 } },
+		[20] = { { 13, 205, 7, 3 }, { 205, 206, 7, 3 } },
+		[21] = { { 13, 207, 7, 3 }, { 207, 158, 7, 3 } },
+		[22] = { { 13, 208, 7, 3 }, { 208, 204, 5, 3 } },
+		[23] = { { 13, 203, 7, 3 }, { 203, 204, 7, 0 } },
+		[24] = { { 13, 209, 7, 3 }, { 209, 206, 5, 3 } },
+		[25] = { { 13, 205, 7, 3 }, { 205, 206, 7, 0 } },
+		[26] = { { 13, 210, 7, 3 }, { 210, 158, 5, 3 } },
+		[27] = { { 13, 207, 7, 3 }, { 207, 158, 7, 0 } },
+		[28] = { { 13, 13, 7, 3 }, { 0, 0, 0, 0 } },
+		[29] = { { 13, 13, 7, 3 }, { 0, 0, 0, 0 } },
+		[30] = { { 13, 13, 7, 3 }, { 0, 0, 0, 0 } },
+		[31] = { { 13, 13, 7, 3 }, { 0, 0, 0, 0 } },
+		[32] = { { 13, 13, 7, 3 }, { 0, 0, 0, 0 } },
+		[33] = { { 13, 13, 7, 3 }, { 0, 0, 0, 0 } },
+		[34] = { { 13, 13, 7, 3 }, { 0, 0, 0, 0 } },
+		[35] = { { 13, 13, 7, 3 }, { 0, 0, 0, 0 } },
+		[36] = { { 13, 13, 7, 3 }, { 0, 0, 0, 0 } },
+	},
+	[8] = {
+		[0] = { { 15, 15, 7, 3 }, { 0, 0, 0, 0 } },
+		[1] = { { 15, 211, 7, 3 }, { 211, 2, 12, 3 } },
+		[2] = { { 15, 212, 7, 3 }, { 212, 4, 12, 3 } },
+		[3] = { { 15, 213, 7, 3 }, { 213, 6, 7, 3 } },
+		[4] = { { 15, 214, 7, 3 }, { 214, 8, 7, 3 } },
+		[5] = { { 15, 215, 7, 3 }, { 215, 10, 7, 3 } },
+		[6] = { { 15, 216, 7, 3 }, { 216, 12, 7, 3 } },
+		[7] = { { 15, 217, 7, 3 }, { 217, 14, 7, 3 } },
+		[8] = { { 15, 15, 7, 3 }, { 15, 16, 7, 3 } },
+		[9] = { { 15, 218, 7, 3 }, { 218, 18, 7, 3 } },
+		[10] = { { 15, 219, 7, 3 }, { 219, 20, 7, 3 } },
+		[11] = { { 15, 220, 7, 3 }, { 220, 22, 7, 3 } },
+		[12] = { { 15, 221, 7, 3 }, { 221, 24, 7, 3 } },
+		[13] = { { 15, 222, 7, 3 }, { 222, 26, 7, 3 } },
+		[14] = { { 15, 223, 7, 3 }, { 223, 28, 7, 3 } },
+		[15] = { { 15, 224, 7, 3 }, { 224, 30, 7, 3 } },
+		[16] = { { 15, 225, 7, 3 }, { 225, 32, 7, 3 } },
+		[17] = { { 15, 226, 7, 3 }, { 226, 34, 6, 3 } },
+		[18] = { { 15, 227, 7, 3 }, { 227, 36, 6, 3 } },
+		[19] = { { 15, 228, 7, 3 }, { 228, 229, 7, 3 } },
+		[20] = { { 15, 230, 7, 3 }, { 230, 231, 7, 3 } },
+		[21] = { { 15, 232, 7, 3 }, { 232, 87, 7, 3 } },
+		[22] = { { 15, 233, 7, 3 }, { 233, 229, 5, 3 } },
+		[23] = { { 15, 228, 7, 3 }, { 228, 229, 7, 0 } },
+		[24] = { { 15, 234, 7, 3 }, { 234, 231, 5, 3 } },
+		[25] = { { 15, 230, 7, 3 }, { 230, 231, 7, 0 } },
+		[26] = { { 15, 235, 7, 3 }, { 235, 87, 5, 3 } },
+		[27] = { { 15, 232, 7, 3 }, { 232, 87, 7, 0 } },
+		[28] = { { 15, 15, 7, 3 }, { 0, 0, 0, 0 } },
+		[29] = { { 15, 15, 7, 3 }, { 0, 0, 0, 0 } },
+		[30] = { { 15, 15, 7, 3 }, { 0, 0, 0, 0 } },
+		[31] = { { 15, 15, 7, 3 }, { 0, 0, 0, 0 } },
+		[32] = { { 15, 15, 7, 3 }, { 0, 0, 0, 0 } },
+		[33] = { { 15, 15, 7, 3 }, { 0, 0, 0, 0 } },
+		[34] = { { 15, 15, 7, 3 }, { 0, 0, 0, 0 } },
+		[35] = { { 15, 15, 7, 3 }, { 0, 0, 0, 0 } },
+		[36] = { { 15, 15, 7, 3 }, { 0, 0, 0, 0 } },
+	},
+	[9] = {
+		[0] = { { 17, 17, 7, 3 }, { 0, 0, 0, 0 } },
+		[1] = { { 17, 236, 7, 3 }, { 236, 2, 12, 3 } },
+		[2] = { { 17, 237, 7, 3 }, { 237, 4, 12, 3 } },
+		[3] = { { 17, 238, 7, 3 }, { 238, 6, 7, 3 } },
+		[4] = { { 17, 239, 7, 3 }, { 239, 8, 7, 3 } },
+		[5] = { { 17, 240, 7, 3 }, { 240, 10, 7, 3 } },
+		[6] = { { 17, 241, 7, 3 }, { 241, 12, 7, 3 } },
+		[7] = { { 17, 193, 7, 3 }, { 193, 14, 7, 3 } },
+		[8] = { { 17, 242, 7, 3 }, { 242, 16, 7, 3 } },
+		[9] = { { 17, 17, 7, 3 }, { 17, 18, 7, 3 } },
+		[10] = { { 17, 243, 7, 3 }, { 243, 20, 7, 3 } },
+		[11] = { { 17, 244, 7, 3 }, { 244, 22, 7, 3 } },
+		[12] = { { 17, 245, 7, 3 }, { 245, 24, 7, 3 } },
+		[13] = { { 17, 246, 7, 3 }, { 246, 26, 7, 3 } },
+		[14] = { { 17, 247, 7, 3 }, { 247, 28, 7, 3 } },
+		[15] = { { 17, 248, 7, 3 }, { 248, 30, 7, 3 } },
+		[16] = { { 17, 249, 7, 3 }, { 249, 32, 7, 3 } },
+		[17] = { { 17, 250, 7, 3 }, { 250, 34, 6, 3 } },
+		[18] = { { 17, 251, 7, 3 }, { 251, 36, 6, 3 } },
+		[19] = { { 17, 252, 7, 3 }, { 252, 253, 7, 3 } },
+		[20] = { { 17, 254, 7, 3 }, { 254, 255, 7, 3 } },
+		[21] = { { 17, 256, 7, 3 }, { 256, 87, 7, 3 } },
+		[22] = { { 17, 257, 7, 3 }, { 257, 253, 5, 3 } },
+		[23] = { { 17, 252, 7, 3 }, { 252, 253, 7, 0 } },
+		[24] = { { 17, 258, 7, 3 }, { 258, 255, 5, 3 } },
+		[25] = { { 17, 254, 7, 3 }, { 254, 255, 7, 0 } },
+		[26] = { { 17, 259, 7, 3 }, { 259, 87, 5, 3 } },
+		[27] = { { 17, 256, 7, 3 }, { 256, 87, 7, 0 } },
+		[28] = { { 17, 17, 7, 3 }, { 0, 0, 0, 0 } },
+		[29] = { { 17, 17, 7, 3 }, { 0, 0, 0, 0 } },
+		[30] = { { 17, 17, 7, 3 }, { 0, 0, 0, 0 } },
+		[31] = { { 17, 17, 7, 3 }, { 0, 0, 0, 0 } },
+		[32] = { { 17, 17, 7, 3 }, { 0, 0, 0, 0 } },
+		[33] = { { 17, 17, 7, 3 }, { 0, 0, 0, 0 } },
+		[34] = { { 17, 17, 7, 3 }, { 0, 0, 0, 0 } },
+		[35] = { { 17, 17, 7, 3 }, { 0, 0, 0, 0 } },
+		[36] = { { 17, 17, 7, 3 }, { 0, 0, 0, 0 } },
+	},
+	[10] = {
+		[0] = { { 19, 19, 7, 3 }, { 0, 0, 0, 0 } },
+		[1] = { { 19, 260, 7, 3 }, { 260, 2, 12, 3 } },
+		[2] = { { 19, 261, 7, 3 }, { 261, 4, 12, 3 } },
+		[3] = { { 19, 262, 7, 3 }, { 262, 6, 7, 3 } },
+		[4] = { { 19, 263, 7, 3 }, { 263, 8, 7, 3 } },
+		[5] = { { 19, 264, 7, 3 }, { 264, 10, 7, 3 } },
+		[6] = { { 19, 265, 7, 3 }, { 265, 12, 7, 3 } },
+		[7] = { { 19, 266, 7, 3 }, { 266, 14, 7, 3 } },
+		[8] = { { 19, 267, 7, 3 }, { 267, 16, 7, 3 } },
+		[9] = { { 19, 268, 7, 3 }, { 268, 18, 7, 3 } },
+		[10] = { { 19, 19, 7, 3 }, { 19, 20, 7, 3 } },
+		[11] = { { 19, 269, 7, 3 }, { 269, 22, 7, 3 } },
+		[12] = { { 19, 270, 7, 3 }, { 270, 24, 7, 3 } },
+		[13] = { { 19, 271, 7, 3 }, { 271, 26, 7, 3 } },
+		[14] = { { 19, 272, 7, 3 }, { 272, 28, 7, 3 } },
+		[15] = { { 19, 273, 7, 3 }, { 273, 30, 7, 3 } },
+		[16] = { { 19, 274, 7, 3 }, { 274, 32, 7, 3 } },
+		[17] = { { 19, 275, 7, 3 }, { 275, 34, 6, 3 } },
+		[18] = { { 19, 276, 7, 3 }, { 276, 36, 6, 3 } },
+		[19] = { { 19, 277, 7, 3 }, { 277, 278, 7, 3 } },
+		[20] = { { 19, 279, 7, 3 }, { 279, 280, 7, 3 } },
+		[21] = { { 19, 281, 7, 3 }, { 281, 87, 7, 3 } },
+		[22] = { { 19, 282, 7, 3 }, { 282, 278, 5, 3 } },
+		[23] = { { 19, 277, 7, 3 }, { 277, 278, 7, 0 } },
+		[24] = { { 19, 283, 7, 3 }, { 283, 280, 5, 3 } },
+		[25] = { { 19, 279, 7, 3 }, { 279, 280, 7, 0 } },
+		[26] = { { 19, 284, 7, 3 }, { 284, 87, 5, 3 } },
+		[27] = { { 19, 281, 7, 3 }, { 281, 87, 7, 0 } },
+		[28] = { { 19, 19, 7, 3 }, { 0, 0, 0, 0 } },
+		[29] = { { 19, 19, 7, 3 }, { 0, 0, 0, 0 } },
+		[30] = { { 19, 19, 7, 3 }, { 0, 0, 0, 0 } },
+		[31] = { { 19, 19, 7, 3 }, { 0, 0, 0, 0 } },
+		[32] = { { 19, 19, 7, 3 }, { 0, 0, 0, 0 } },
+		[33] = { { 19, 19, 7, 3 }, { 0, 0, 0, 0 } },
+		[34] = { { 19, 19, 7, 3 }, { 0, 0, 0, 0 } },
+		[35] = { { 19, 19, 7, 3 }, { 0, 0, 0, 0 } },
+		[36] = { { 19, 19, 7, 3 }, { 0, 0, 0, 0 } },
+	},
+	[11] = {
+		[0] = { { 21, 21, 7, 3 }, { 0, 0, 0, 0 } },
+		[1] = { { 21, 285, 7, 3 }, { 285, 2, 12, 3 } },
+		[2] = { { 21, 286, 7, 3 }, { 286, 4, 12, 3 } },
+		[3] = { { 21, 287, 7, 3 }, { 287, 6, 7, 3 } },
+		[4] = { { 21, 288, 7, 3 }, { 288, 8, 7, 3 } },
+		[5] = { { 21, 289, 7, 3 }, { 289, 10, 7, 3 } },
+		[6] = { { 21, 290, 7, 3 }, { 290, 12, 7, 3 } },
+		[7] = { { 21, 291, 7, 3 }, { 291, 14, 7, 3 } },
+		[8] = { { 21, 292, 7, 3 }, { 292, 16, 7, 3 } },
+		[9] = { { 21, 293, 7, 3 }, { 293, 18, 7, 3 } },
+		[10] = { { 21, 294, 7, 3 }, { 294, 20, 7, 3 } },
+		[11] = { { 21, 21, 7, 3 }, { 21, 22, 7, 3 } },
+		[12] = { { 21, 295, 7, 3 }, { 295, 24, 7, 3 } },
+		[13] = { { 21, 296, 7, 3 }, { 296, 26, 7, 3 } },
+		[14] = { { 21, 297, 7, 3 }, { 297, 28, 7, 3 } },
+		[15] = { { 21, 298, 7, 3 }, { 298, 30, 7, 3 } },
+		[16] = { { 21, 299, 7, 3 }, { 299, 32, 7, 3 } },
+		[17] = { { 21, 300, 7, 3 }, { 300, 34, 6, 3 } },
+		[18] = { { 21, 301, 7, 3 }, { 301, 36, 6, 3 } },
+		[19] = { { 21, 302, 7, 3 }, { 302, 83, 7, 3 } },
+		[20] = { { 21, 303, 7, 3 }, { 303, 85, 7, 3 } },
+		[21] = { { 21, 304, 7, 3 }, { 304, 305, 7, 3 } },
+		[22] = { { 21, 306, 7, 3 }, { 306, 83, 5, 3 } },
+		[23] = { { 21, 302, 7, 3 }, { 302, 83, 7, 0 } },
+		[24] = { { 21, 307, 7, 3 }, { 307, 85, 5, 3 } },
+		[25] = { { 21, 303, 7, 3 }, { 303, 85, 7, 0 } },
+		[26] = { { 21, 308, 7, 3 }, { 308, 305, 5, 3 } },
+		[27] = { { 21, 304, 7, 3 }, { 304, 305, 7, 0 } },
+		[28] = { { 21, 21, 7, 3 }, { 0, 0, 0, 0 } },
+		[29] = { { 21, 21, 7, 3 }, { 0, 0, 0, 0 } },
+		[30] = { { 21, 21, 7, 3 }, { 0, 0, 0, 0 } },
+		[31] = { { 21, 21, 7, 3 }, { 0, 0, 0, 0 } },
+		[32] = { { 21, 21, 7, 3 }, { 0, 0, 0, 0 } },
+		[33] = { { 21, 21, 7, 3 }, { 0, 0, 0, 0 } },
+		[34] = { { 21, 21, 7, 3 }, { 0, 0, 0, 0 } },
+		[35] = { { 21, 21, 7, 3 }, { 0, 0, 0, 0 } },
+		[36] = { { 21, 21, 7, 3 }, { 0, 0, 0, 0 } },
+	},
+	[12] = {
+		[0] = { { 23, 23, 7, 3 }, { 0, 0, 0, 0 } },
+		[1] = { { 23, 309, 7, 3 }, { 309, 2, 12, 3 } },
+		[2] = { { 23, 310, 7, 3 }, { 310, 4, 12, 3 } },
+		[3] = { { 23, 311, 7, 3 }, { 311, 6, 7, 3 } },
+		[4] = { { 23, 312, 7, 3 }, { 312, 8, 7, 3 } },
+		[5] = { { 23, 313, 7, 3 }, { 313, 10, 7, 3 } },
+		[6] = { { 23, 314, 7, 3 }, { 314, 12, 7, 3 } },
+		[7] = { { 23, 315, 7, 3 }, { 315, 14, 7, 3 } },
+		[8] = { { 23, 316, 7, 3 }, { 316, 16, 7, 3 } },
+		[9] = { { 23, 317, 7, 3 }, { 317, 18, 7, 3 } },
+		[10] = { { 23, 318, 7, 3 }, { 318, 20, 7, 3 } },
+		[11] = { { 23, 319, 7, 3 }, { 319, 22, 7, 3 } },
+		[12] = { { 23, 23, 7, 3 }, { 23, 24, 7, 3 } },
+		[13] = { { 23, 320, 7, 3 }, { 320, 26, 7, 3 } },
+		[14] = { { 23, 321, 7, 3 }, { 321, 28, 7, 3 } },
+		[15] = { { 23, 322, 7, 3 }, { 322, 30, 7, 3 } },
+		[16] = { { 23, 323, 7, 3 }, { 323, 32, 7, 3 } },
+		[17] = { { 23, 324, 7, 3 }, { 324, 34, 6, 3 } },
+		[18] = { { 23, 325, 7, 3 }, { 325, 36, 6, 3 } },
+		[19] = { { 23, 326, 7, 3 }, { 326, 327, 7, 3 } },
+		[20] = { { 23, 328, 7, 3 }, { 328, 329, 7, 3 } },
+		[21] = { { 23, 330, 7, 3 }, { 330, 158, 7, 3 } },
+		[22] = { { 23, 331, 7, 3 }, { 331, 327, 5, 3 } },
+		[23] = { { 23, 326, 7, 3 }, { 326, 327, 7, 0 } },
+		[24] = { { 23, 332, 7, 3 }, { 332, 329, 5, 3 } },
+		[25] = { { 23, 328, 7, 3 }, { 328, 329, 7, 0 } },
+		[26] = { { 23, 333, 7, 3 }, { 333, 158, 5, 3 } },
+		[27] = { { 23, 330, 7, 3 }, { 330, 158, 7, 0 } },
+		[28] = { { 23, 23, 7, 3 }, { 0, 0, 0, 0 } },
+		[29] = { { 23, 23, 7, 3 }, { 0, 0, 0, 0 } },
+		[30] = { { 23, 23, 7, 3 }, { 0, 0, 0, 0 } },
+		[31] = { { 23, 23, 7, 3 }, { 0, 0, 0, 0 } },
+		[32] = { { 23, 23, 7, 3 }, { 0, 0, 0, 0 } },
+		[33] = { { 23, 23, 7, 3 }, { 0, 0, 0, 0 } },
+		[34] = { { 23, 23, 7, 3 }, { 0, 0, 0, 0 } },
+		[35] = { { 23, 23, 7, 3 }, { 0, 0, 0, 0 } },
+		[36] = { { 23, 23, 7, 3 }, { 0, 0, 0, 0 } },
+	},
+	[13] = {
+		[0] = { { 25, 25, 7, 3 }, { 0, 0, 0, 0 } },
+		[1] = { { 25, 334, 7, 3 }, { 334, 2, 12, 3 } },
+		[2] = { { 25, 335, 7, 3 }, { 335, 4, 12, 3 } },
+		[3] = { { 25, 336, 7, 3 }, { 336, 6, 7, 3 } },
+		[4] = { { 25, 337, 7, 3 }, { 337, 8, 7, 3 } },
+		[5] = { { 25, 338, 7, 3 }, { 338, 10, 7, 3 } },
+		[6] = { { 25, 339, 7, 3 }, { 339, 12, 7, 3 } },
+		[7] = { { 25, 340, 7, 3 }, { 340, 14, 7, 3 } },
+		[8] = { { 25, 341, 7, 3 }, { 341, 16, 7, 3 } },
+		[9] = { { 25, 342, 7, 3 }, { 342, 18, 7, 3 } },
+		[10] = { { 25, 271, 7, 3 }, { 271, 20, 7, 3 } },
+		[11] = { { 25, 343, 7, 3 }, { 343, 22, 7, 3 } },
+		[12] = { { 25, 344, 7, 3 }, { 344, 24, 7, 3 } },
+		[13] = { { 25, 25, 7, 3 }, { 25, 26, 7, 3 } },
+		[14] = { { 25, 345, 7, 3 }, { 345, 28, 7, 3 } },
+		[15] = { { 25, 346, 7, 3 }, { 346, 30, 7, 3 } },
+		[16] = { { 25, 347, 7, 3 }, { 347, 32, 7, 3 } },
+		[17] = { { 25, 348, 7, 3 }, { 348, 34, 6, 3 } },
+		[18] = { { 25, 349, 7, 3 }, { 349, 36, 6, 3 } },
+		[19] = { { 25, 350, 7, 3 }, { 350, 351, 7, 3 } },
+		[20] = { { 25, 352, 7, 3 }, { 352, 353, 7, 3 } },
+		[21] = { { 25, 354, 7, 3 }, { 354, 87, 7, 3 } },
+		[22] = { { 25, 355, 7, 3 }, { 355, 351, 5, 3 } },
+		[23] = { { 25, 350, 7, 3 }, { 350, 351, 7, 0 } },
+		[24] = { { 25, 356, 7, 3 }, { 356, 353, 5, 3 } },
+		[25] = { { 25, 352, 7, 3 }, { 352, 353, 7, 0 } },
+		[26] = { { 25, 357, 7, 3 }, { 357, 87, 5, 3 } },
+		[27] = { { 25, 354, 7, 3 }, { 354, 87, 7, 0 } },
+		[28] = { { 25, 25, 7, 3 }, { 0, 0, 0, 0 } },
+		[29] = { { 25, 25, 7, 3 }, { 0, 0, 0, 0 } },
+		[30] = { { 25, 25, 7, 3 }, { 0, 0, 0, 0 } },
+		[31] = { { 25, 25, 7, 3 }, { 0, 0, 0, 0 } },
+		[32] = { { 25, 25, 7, 3 }, { 0, 0, 0, 0 } },
+		[33] = { { 25, 25, 7, 3 }, { 0, 0, 0, 0 } },
+		[34] = { { 25, 25, 7, 3 }, { 0, 0, 0, 0 } },
+		[35] = { { 25, 25, 7, 3 }, { 0, 0, 0, 0 } },
+		[36] = { { 25, 25, 7, 3 }, { 0, 0, 0, 0 } },
+	},
+	[14] = {
+		[0] = { { 27, 27, 7, 3 }, { 0, 0, 0, 0 } },
+		[1] = { { 27, 358, 7, 3 }, { 358, 2, 12, 3 } },
+		[2] = { { 27, 359, 7, 3 }, { 359, 4, 12, 3 } },
+		[3] = { { 27, 360, 7, 3 }, { 360, 6, 7, 3 } },
+		[4] = { { 27, 361, 7, 3 }, { 361, 8, 7, 3 } },
+		[5] = { { 27, 362, 7, 3 }, { 362, 10, 7, 3 } },
+		[6] = { { 27, 363, 7, 3 }, { 363, 12, 7, 3 } },
+		[7] = { { 27, 364, 7, 3 }, { 364, 14, 7, 3 } },
+		[8] = { { 27, 365, 7, 3 }, { 365, 16, 7, 3 } },
+		[9] = { { 27, 366, 7, 3 }, { 366, 18, 7, 3 } },
+		[10] = { { 27, 367, 7, 3 }, { 367, 20, 7, 3 } },
+		[11] = { { 27, 368, 7, 3 }, { 368, 22, 7, 3 } },
+		[12] = { { 27, 369, 7, 3 }, { 369, 24, 7, 3 } },
+		[13] = { { 27, 370, 7, 3 }, { 370, 26, 7, 3 } },
+		[14] = { { 27, 27, 7, 3 }, { 27, 28, 7, 3 } },
+		[15] = { { 27, 371, 7, 3 }, { 371, 30, 7, 3 } },
+		[16] = { { 27, 372, 7, 3 }, { 372, 32, 7, 3 } },
+		[17] = { { 27, 373, 7, 3 }, { 373, 34, 6, 3 } },
+		[18] = { { 27, 374, 7, 3 }, { 374, 36, 6, 3 } },
+		[19] = { { 27, 375, 7, 3 }, { 375, 376, 7, 3 } },
+		[20] = { { 27, 377, 7, 3 }, { 377, 378, 7, 3 } },
+		[21] = { { 27, 379, 7, 3 }, { 379, 158, 7, 3 } },
+		[22] = { { 27, 380, 7, 3 }, { 380, 376, 5, 3 } },
+		[23] = { { 27, 375, 7, 3 }, { 375, 376, 7, 0 } },
+		[24] = { { 27, 381, 7, 3 }, { 381, 378, 5, 3 } },
+		[25] = { { 27, 377, 7, 3 }, { 377, 378, 7, 0 } },
+		[26] = { { 27, 382, 7, 3 }, { 382, 158, 5, 3 } },
+		[27] = { { 27, 379, 7, 3 }, { 379, 158, 7, 0 } },
+		[28] = { { 27, 27, 7, 3 }, { 0, 0, 0, 0 } },
+		[29] = { { 27, 27, 7, 3 }, { 0, 0, 0, 0 } },
+		[30] = { { 27, 27, 7, 3 }, { 0, 0, 0, 0 } },
+		[31] = { { 27, 27, 7, 3 }, { 0, 0, 0, 0 } },
+		[32] = { { 27, 27, 7, 3 }, { 0, 0, 0, 0 } },
+		[33] = { { 27, 27, 7, 3 }, { 0, 0, 0, 0 } },
+		[34] = { { 27, 27, 7, 3 }, { 0, 0, 0, 0 } },
+		[35] = { { 27, 27, 7, 3 }, { 0, 0, 0, 0 } },
+		[36] = { { 27, 27, 7, 3 }, { 0, 0, 0, 0 } },
+	},
+	[15] = {
+		[0] = { { 29, 29, 7, 3 }, { 0, 0, 0, 0 } },
+		[1] = { { 29, 383, 7, 3 }, { 383, 2, 12, 3 } },
+		[2] = { { 29, 384, 7, 3 }, { 384, 4, 12, 3 } },
+		[3] = { { 29, 385, 7, 3 }, { 385, 6, 7, 3 } },
+		[4] = { { 29, 386, 7, 3 }, { 386, 8, 7, 3 } },
+		[5] = { { 29, 387, 7, 3 }, { 387, 10, 7, 3 } },
+		[6] = { { 29, 388, 7, 3 }, { 388, 12, 7, 3 } },
+		[7] = { { 29, 389, 7, 3 }, { 389, 14, 7, 3 } },
+		[8] = { { 29, 390, 7, 3 }, { 390, 16, 7, 3 } },
+		[9] = { { 29, 391, 7, 3 }, { 391, 18, 7, 3 } },
+		[10] = { { 29, 392, 7, 3 }, { 392, 20, 7, 3 } },
+		[11] = { { 29, 393, 7, 3 }, { 393, 22, 7, 3 } },
+		[12] = { { 29, 394, 7, 3 }, { 394, 24, 7, 3 } },
+		[13] = { { 29, 395, 7, 3 }, { 395, 26, 7, 3 } },
+		[14] = { { 29, 371, 7, 3 }, { 371, 28, 7, 3 } },
+		[15] = { { 29, 29, 7, 3 }, { 29, 30, 7, 3 } },
+		[16] = { { 29, 396, 7, 3 }, { 396, 32, 7, 3 } },
+		[17] = { { 29, 397, 7, 3 }, { 397, 34, 6, 3 } },
+		[18] = { { 29, 398, 7, 3 }, { 398, 36, 6, 3 } },
+		[19] = { { 29, 399, 7, 3 }, { 399, 400, 7, 3 } },
+		[20] = { { 29, 401, 7, 3 }, { 401, 402, 7, 3 } },
+		[21] = { { 29, 403, 7, 3 }, { 403, 404, 7, 3 } },
+		[22] = { { 29, 405, 7, 3 }, { 405, 400, 5, 3 } },
+		[23] = { { 29, 399, 7, 3 }, { 399, 400, 7, 0 } },
+		[24] = { { 29, 406, 7, 3 }, { 406, 402, 5, 3 } },
+		[25] = { { 29, 401, 7, 3 }, { 401, 402, 7, 0 } },
+		[26] = { { 29, 407, 7, 3 }, { 407, 404, 5, 3 } },
+		[27] = { { 29, 403, 7, 3 }, { 403, 404, 7, 0 } },
+		[28] = { { 29, 29, 7, 3 }, { 0, 0, 0, 0 } },
+		[29] = { { 29, 29, 7, 3 }, { 0, 0, 0, 0 } },
+		[30] = { { 29, 29, 7, 3 }, { 0, 0, 0, 0 } },
+		[31] = { { 29, 29, 7, 3 }, { 0, 0, 0, 0 } },
+		[32] = { { 29, 29, 7, 3 }, { 0, 0, 0, 0 } },
+		[33] = { { 29, 29, 7, 3 }, { 0, 0, 0, 0 } },
+		[34] = { { 29, 29, 7, 3 }, { 0, 0, 0, 0 } },
+		[35] = { { 29, 29, 7, 3 }, { 0, 0, 0, 0 } },
+		[36] = { { 29, 29, 7, 3 }, { 0, 0, 0, 0 } },
+	},
+	[16] = {
+		[0] = { { 31, 31, 7, 3 }, { 0, 0, 0, 0 } },
+		[1] = { { 31, 408, 7, 3 }, { 408, 2, 12, 3 } },
+		[2] = { { 31, 409, 7, 3 }, { 409, 4, 12, 3 } },
+		[3] = { { 31, 410, 7, 3 }, { 410, 6, 7, 3 } },
+		[4] = { { 31, 411, 7, 3 }, { 411, 8, 7, 3 } },
+		[5] = { { 31, 412, 7, 3 }, { 412, 10, 7, 3 } },
+		[6] = { { 31, 413, 7, 3 }, { 413, 12, 7, 3 } },
+		[7] = { { 31, 414, 7, 3 }, { 414, 14, 7, 3 } },
+		[8] = { { 31, 415, 7, 3 }, { 415, 16, 7, 3 } },
+		[9] = { { 31, 416, 7, 3 }, { 416, 18, 7, 3 } },
+		[10] = { { 31, 417, 7, 3 }, { 417, 20, 7, 3 } },
+		[11] = { { 31, 418, 7, 3 }, { 418, 22, 7, 3 } },
+		[12] = { { 31, 323, 7, 3 }, { 323, 24, 7, 3 } },
+		[13] = { { 31, 419, 7, 3 }, { 419, 26, 7, 3 } },
+		[14] = { { 31, 420, 7, 3 }, { 420, 28, 7, 3 } },
+		[15] = { { 31, 421, 7, 3 }, { 421, 30, 7, 3 } },
+		[16] = { { 31, 31, 7, 3 }, { 31, 32, 7, 3 } },
+		[17] = { { 31, 422, 7, 3 }, { 422, 34, 6, 3 } },
+		[18] = { { 31, 423, 7, 3 }, { 423, 36, 6, 3 } },
+		[19] = { { 31, 424, 7, 3 }, { 424, 425, 7, 3 } },
+		[20] = { { 31, 426, 7, 3 }, { 426, 427, 7, 3 } },
+		[21] = { { 31, 428, 7, 3 }, { 428, 429, 7, 3 } },
+		[22] = { { 31, 430, 7, 3 }, { 430, 425, 5, 3 } },
+		[23] = { { 31, 424, 7, 3 }, { 424, 425, 7, 0 } },
+		[24] = { { 31, 431, 7, 3 }, { 431, 427, 5, 3 } },
+		[25] = { { 31, 426, 7, 3 }, { 426, 427, 7, 0 } },
+		[26] = { { 31, 432, 7, 3 }, { 432, 429, 5, 3 } },
+		[27] = { { 31, 428, 7, 3 }, { 428, 429, 7, 0 } },
+		[28] = { { 31, 31, 7, 3 }, { 0, 0, 0, 0 } },
+		[29] = { { 31, 31, 7, 3 }, { 0, 0, 0, 0 } },
+		[30] = { { 31, 31, 7, 3 }, { 0, 0, 0, 0 } },
+		[31] = { { 31, 31, 7, 3 }, { 0, 0, 0, 0 } },
+		[32] = { { 31, 31, 7, 3 }, { 0, 0, 0, 0 } },
+		[33] = { { 31, 31, 7, 3 }, { 0, 0, 0, 0 } },
+		[34] = { { 31, 31, 7, 3 }, { 0, 0, 0, 0 } },
+		[35] = { { 31, 31, 7, 3 }, { 0, 0, 0, 0 } },
+		[36] = { { 31, 31, 7, 3 }, { 0, 0, 0, 0 } },
+	},
+	[17] = {
+		[0] = { { 33, 33, 6, 3 }, { 0, 0, 0, 0 } },
+		[1] = { { 33, 433, 6, 3 }, { 433, 2, 12, 3 } },
+		[2] = { { 33, 434, 6, 3 }, { 434, 4, 12, 3 } },
+		[3] = { { 33, 435, 6, 3 }, { 435, 6, 7, 3 } },
+		[4] = { { 33, 436, 6, 3 }, { 436, 8, 7, 3 } },
+		[5] = { { 33, 437, 6, 3 }, { 437, 10, 7, 3 } },
+		[6] = { { 33, 438, 6, 3 }, { 438, 12, 7, 3 } },
+		[7] = { { 33, 439, 6, 3 }, { 439, 14, 7, 3 } },
+		[8] = { { 33, 440, 6, 3 }, { 440, 16, 7, 3 } },
+		[9] = { { 33, 441, 6, 3 }, { 441, 18, 7, 3 } },
+		[10] = { { 33, 442, 6, 3 }, { 442, 20, 7, 3 } },
+		[11] = { { 33, 443, 6, 3 }, { 443, 22, 7, 3 } },
+		[12] = { { 33, 444, 6, 3 }, { 444, 24, 7, 3 } },
+		[13] = { { 33, 445, 6, 3 }, { 445, 26, 7, 3 } },
+		[14] = { { 33, 446, 6, 3 }, { 446, 28, 7, 3 } },
+		[15] = { { 33, 447, 6, 3 }, { 447, 30, 7, 3 } },
+		[16] = { { 33, 448, 6, 3 }, { 448, 32, 7, 3 } },
+		[17] = { { 33, 33, 6, 3 }, { 33, 34, 6, 3 } },
+		[18] = { { 33, 449, 6, 3 }, { 449, 36, 6, 3 } },
+		[19] = { { 33, 450, 6, 3 }, { 450, 451, 7, 3 } },
+		[20] = { { 33, 452, 6, 3 }, { 452, 453, 7, 3 } },
+		[21] = { { 33, 454, 6, 3 }, { 454, 455, 7, 3 } },
+		[22] = { { 33, 456, 6, 3 }, { 456, 451, 5, 3 } },
+		[23] = { { 33, 450, 6, 3 }, { 450, 451, 7, 0 } },
+		[24] = { { 33, 457, 6, 3 }, { 457, 453, 5, 3 } },
+		[25] = { { 33, 452, 6, 3 }, { 452, 453, 7, 0 } },
+		[26] = { { 33, 458, 6, 3 }, { 458, 455, 5, 3 } },
+		[27] = { { 33, 454, 6, 3 }, { 454, 455, 7, 0 } },
+		[28] = { { 33, 33, 6, 3 }, { 0, 0, 0, 0 } },
+		[29] = { { 33, 33, 6, 3 }, { 0, 0, 0, 0 } },
+		[30] = { { 33, 33, 6, 3 }, { 0, 0, 0, 0 } },
+		[31] = { { 33, 33, 6, 3 }, { 0, 0, 0, 0 } },
+		[32] = { { 33, 33, 6, 3 }, { 0, 0, 0, 0 } },
+		[33] = { { 33, 33, 6, 3 }, { 0, 0, 0, 0 } },
+		[34] = { { 33, 33, 6, 3 }, { 0, 0, 0, 0 } },
+		[35] = { { 33, 33, 6, 3 }, { 0, 0, 0, 0 } },
+		[36] = { { 33, 33, 6, 3 }, { 0, 0, 0, 0 } },
+	},
+	[18] = {
+		[0] = { { 35, 35, 6, 3 }, { 0, 0, 0, 0 } },
+		[1] = { { 35, 459, 6, 3 }, { 459, 2, 12, 3 } },
+		[2] = { { 35, 460, 6, 3 }, { 460, 4, 12, 3 } },
+		[3] = { { 35, 461, 6, 3 }, { 461, 6, 7, 3 } },
+		[4] = { { 35, 462, 6, 3 }, { 462, 8, 7, 3 } },
+		[5] = { { 35, 463, 6, 3 }, { 463, 10, 7, 3 } },
+		[6] = { { 35, 464, 6, 3 }, { 464, 12, 7, 3 } },
+		[7] = { { 35, 465, 6, 3 }, { 465, 14, 7, 3 } },
+		[8] = { { 35, 466, 6, 3 }, { 466, 16, 7, 3 } },
+		[9] = { { 35, 467, 6, 3 }, { 467, 18, 7, 3 } },
+		[10] = { { 35, 468, 6, 3 }, { 468, 20, 7, 3 } },
+		[11] = { { 35, 469, 6, 3 }, { 469, 22, 7, 3 } },
+		[12] = { { 35, 470, 6, 3 }, { 470, 24, 7, 3 } },
+		[13] = { { 35, 471, 6, 3 }, { 471, 26, 7, 3 } },
+		[14] = { { 35, 472, 6, 3 }, { 472, 28, 7, 3 } },
+		[15] = { { 35, 473, 6, 3 }, { 473, 30, 7, 3 } },
+		[16] = { { 35, 474, 6, 3 }, { 474, 32, 7, 3 } },
+		[17] = { { 35, 475, 6, 3 }, { 475, 34, 6, 3 } },
+		[18] = { { 35, 35, 6, 3 }, { 35, 36, 6, 3 } },
+		[19] = { { 35, 476, 6, 3 }, { 476, 38, 7, 3 } },
+		[20] = { { 35, 476, 6, 3 }, { 476, 38, 7, 3 } },
+		[21] = { { 35, 476, 6, 3 }, { 476, 38, 7, 3 } },
+		[22] = { { 35, 477, 6, 3 }, { 477, 38, 5, 3 } },
+		[23] = { { 35, 476, 6, 3 }, { 476, 38, 7, 0 } },
+		[24] = { { 35, 477, 6, 3 }, { 477, 38, 5, 3 } },
+		[25] = { { 35, 476, 6, 3 }, { 476, 38, 7, 0 } },
+		[26] = { { 35, 477, 6, 3 }, { 477, 38, 5, 3 } },
+		[27] = { { 35, 476, 6, 3 }, { 476, 38, 7, 0 } },
+		[28] = { { 35, 35, 6, 3 }, { 0, 0, 0, 0 } },
+		[29] = { { 35, 35, 6, 3 }, { 0, 0, 0, 0 } },
+		[30] = { { 35, 35, 6, 3 }, { 0, 0, 0, 0 } },
+		[31] = { { 35, 35, 6, 3 }, { 0, 0, 0, 0 } },
+		[32] = { { 35, 35, 6, 3 }, { 0, 0, 0, 0 } },
+		[33] = { { 35, 35, 6, 3 }, { 0, 0, 0, 0 } },
+		[34] = { { 35, 35, 6, 3 }, { 0, 0, 0, 0 } },
+		[35] = { { 35, 35, 6, 3 }, { 0, 0, 0, 0 } },
+		[36] = { { 35, 35, 6, 3 }, { 0, 0, 0, 0 } },
+	},
+	[19] = {
+		[0] = { { 37, 37, 7, 3 }, { 0, 0, 0, 0 } },
+		[1] = { { 479, 480, 7, 3 }, { 480, 2, 12, 3 } },
+		[2] = { { 481, 482, 7, 3 }, { 482, 4, 12, 3 } },
+		[3] = { { 479, 483, 7, 3 }, { 483, 6, 7, 3 } },
+		[4] = { { 481, 484, 7, 3 }, { 484, 8, 7, 3 } },
+		[5] = { { 485, 153, 7, 3 }, { 153, 10, 7, 3 } },
+		[6] = { { 486, 178, 7, 3 }, { 178, 12, 7, 3 } },
+		[7] = { { 487, 488, 7, 3 }, { 488, 14, 7, 3 } },
+		[8] = { { 489, 228, 7, 3 }, { 228, 16, 7, 3 } },
+		[9] = { { 490, 491, 7, 3 }, { 491, 18, 7, 3 } },
+		[10] = { { 492, 493, 7, 3 }, { 493, 20, 7, 3 } },
+		[11] = { { 481, 494, 7, 3 }, { 494, 22, 7, 3 } },
+		[12] = { { 495, 496, 7, 3 }, { 496, 24, 7, 3 } },
+		[13] = { { 497, 498, 7, 3 }, { 498, 26, 7, 3 } },
+		[14] = { { 499, 500, 7, 3 }, { 500, 28, 7, 3 } },
+		[15] = { { 501, 502, 7, 3 }, { 502, 30, 7, 3 } },
+		[16] = { { 503, 504, 7, 3 }, { 504, 32, 7, 3 } },
+		[17] = { { 505, 506, 7, 3 }, { 506, 34, 6, 3 } },
+		[18] = { { 37, 507, 7, 3 }, { 507, 36, 6, 3 } },
+		[19] = { { 37, 37, 7, 3 }, { 37, 38, 7, 3 } },
+		[20] = { { 37, 37, 7, 3 }, { 37, 38, 7, 3 } },
+		[21] = { { 37, 37, 7, 3 }, { 37, 38, 7, 3 } },
+		[22] = { { 37, 37, 7, 3 }, { 37, 38, 5, 3 } },
+		[23] = { { 37, 37, 7, 3 }, { 37, 38, 7, 0 } },
+		[24] = { { 37, 37, 7, 3 }, { 37, 38, 5, 3 } },
+		[25] = { { 37, 37, 7, 3 }, { 37, 38, 7, 0 } },
+		[26] = { { 37, 37, 7, 3 }, { 37, 38, 5, 3 } },
+		[27] = { { 37, 37, 7, 3 }, { 37, 38, 7, 0 } },
+		[28] = { { 37, 37, 7, 3 }, { 0, 0, 0, 0 } },
+		[29] = { { 37, 37, 7, 3 }, { 0, 0, 0, 0 } },
+		[30] = { { 37, 37, 7, 3 }, { 0, 0, 0, 0 } },
+		[31] = { { 37, 37, 7, 3 }, { 0, 0, 0, 0 } },
+		[32] = { { 37, 37, 7, 3 }, { 0, 0, 0, 0 } },
+		[33] = { { 37, 37, 7, 3 }, { 0, 0, 0, 0 } },
+		[34] = { { 37, 37, 7, 3 }, { 0, 0, 0, 0 } },
+		[35] = { { 37, 37, 7, 3 }, { 0, 0, 0, 0 } },
+		[36] = { { 37, 37, 7, 3 }, { 0, 0, 0, 0 } },
+	},
+	[20] = {
+		[0] = { { 37, 37, 7, 3 }, { 0, 0, 0, 0 } },
+		[1] = { { 509, 510, 7, 3 }, { 510, 2, 12, 3 } },
+		[2] = { { 511, 512, 7, 3 }, { 512, 4, 12, 3 } },
+		[3] = { { 509, 513, 7, 3 }, { 513, 6, 7, 3 } },
+		[4] = { { 511, 514, 7, 3 }, { 514, 8, 7, 3 } },
+		[5] = { { 515, 155, 7, 3 }, { 155, 10, 7, 3 } },
+		[6] = { { 516, 180, 7, 3 }, { 180, 12, 7, 3 } },
+		[7] = { { 517, 518, 7, 3 }, { 518, 14, 7, 3 } },
+		[8] = { { 519, 230, 7, 3 }, { 230, 16, 7, 3 } },
+		[9] = { { 520, 521, 7, 3 }, { 521, 18, 7, 3 } },
+		[10] = { { 522, 523, 7, 3 }, { 523, 20, 7, 3 } },
+		[11] = { { 511, 524, 7, 3 }, { 524, 22, 7, 3 } },
+		[12] = { { 525, 526, 7, 3 }, { 526, 24, 7, 3 } },
+		[13] = { { 527, 528, 7, 3 }, { 528, 26, 7, 3 } },
+		[14] = { { 529, 530, 7, 3 }, { 530, 28, 7, 3 } },
+		[15] = { { 531, 532, 7, 3 }, { 532, 30, 7, 3 } },
+		[16] = { { 533, 534, 7, 3 }, { 534, 32, 7, 3 } },
+		[17] = { { 535, 536, 7, 3 }, { 536, 34, 6, 3 } },
+		[18] = { { 37, 507, 7, 3 }, { 507, 36, 6, 3 } },
+		[19] = { { 37, 37, 7, 3 }, { 37, 38, 7, 3 } },
+		[20] = { { 37, 37, 7, 3 }, { 37, 38, 7, 3 } },
+		[21] = { { 37, 37, 7, 3 }, { 37, 38, 7, 3 } },
+		[22] = { { 37, 37, 7, 3 }, { 37, 38, 5, 3 } },
+		[23] = { { 37, 37, 7, 3 }, { 37, 38, 7, 0 } },
+		[24] = { { 37, 37, 7, 3 }, { 37, 38, 5, 3 } },
+		[25] = { { 37, 37, 7, 3 }, { 37, 38, 7, 0 } },
+		[26] = { { 37, 37, 7, 3 }, { 37, 38, 5, 3 } },
+		[27] = { { 37, 37, 7, 3 }, { 37, 38, 7, 0 } },
+		[28] = { { 37, 37, 7, 3 }, { 0, 0, 0, 0 } },
+		[29] = { { 37, 37, 7, 3 }, { 0, 0, 0, 0 } },
+		[30] = { { 37, 37, 7, 3 }, { 0, 0, 0, 0 } },
+		[31] = { { 37, 37, 7, 3 }, { 0, 0, 0, 0 } },
+		[32] = { { 37, 37, 7, 3 }, { 0, 0, 0, 0 } },
+		[33] = { { 37, 37, 7, 3 }, { 0, 0, 0, 0 } },
+		[34] = { { 37, 37, 7, 3 }, { 0, 0, 0, 0 } },
+		[35] = { { 37, 37, 7, 3 }, { 0, 0, 0, 0 } },
+		[36] = { { 37, 37, 7, 3 }, { 0, 0, 0, 0 } },
+	},
+	[21] = {
+		[0] = { { 37, 37, 7, 3 }, { 0, 0, 0, 0 } },
+		[1] = { { 538, 539, 7, 3 }, { 539, 2, 12, 3 } },
+		[2] = { { 540, 541, 7, 3 }, { 541, 4, 12, 3 } },
+		[3] = { { 538, 542, 7, 3 }, { 542, 6, 7, 3 } },
+		[4] = { { 540, 543, 7, 3 }, { 543, 8, 7, 3 } },
+		[5] = { { 544, 545, 7, 3 }, { 545, 10, 7, 3 } },
+		[6] = { { 540, 546, 7, 3 }, { 546, 12, 7, 3 } },
+		[7] = { { 544, 547, 7, 3 }, { 547, 14, 7, 3 } },
+		[8] = { { 540, 548, 7, 3 }, { 548, 16, 7, 3 } },
+		[9] = { { 540, 256, 7, 3 }, { 256, 18, 7, 3 } },
+		[10] = { { 540, 549, 7, 3 }, { 549, 20, 7, 3 } },
+		[11] = { { 550, 551, 7, 3 }, { 551, 22, 7, 3 } },
+		[12] = { { 544, 552, 7, 3 }, { 552, 24, 7, 3 } },
+		[13] = { { 540, 553, 7, 3 }, { 553, 26, 7, 3 } },
+		[14] = { { 544, 554, 7, 3 }, { 554, 28, 7, 3 } },
+		[15] = { { 555, 556, 7, 3 }, { 556, 30, 7, 3 } },
+		[16] = { { 557, 558, 7, 3 }, { 558, 32, 7, 3 } },
+		[17] = { { 559, 560, 7, 3 }, { 560, 34, 6, 3 } },
+		[18] = { { 37, 507, 7, 3 }, { 507, 36, 6, 3 } },
+		[19] = { { 37, 37, 7, 3 }, { 37, 38, 7, 3 } },
+		[20] = { { 37, 37, 7, 3 }, { 37, 38, 7, 3 } },
+		[21] = { { 37, 37, 7, 3 }, { 37, 38, 7, 3 } },
+		[22] = { { 37, 37, 7, 3 }, { 37, 38, 5, 3 } },
+		[23] = { { 37, 37, 7, 3 }, { 37, 38, 7, 0 } },
+		[24] = { { 37, 37, 7, 3 }, { 37, 38, 5, 3 } },
+		[25] = { { 37, 37, 7, 3 }, { 37, 38, 7, 0 } },
+		[26] = { { 37, 37, 7, 3 }, { 37, 38, 5, 3 } },
+		[27] = { { 37, 37, 7, 3 }, { 37, 38, 7, 0 } },
+		[28] = { { 37, 37, 7, 3 }, { 0, 0, 0, 0 } },
+		[29] = { { 37, 37, 7, 3 }, { 0, 0, 0, 0 } },
+		[30] = { { 37, 37, 7, 3 }, { 0, 0, 0, 0 } },
+		[31] = { { 37, 37, 7, 3 }, { 0, 0, 0, 0 } },
+		[32] = { { 37, 37, 7, 3 }, { 0, 0, 0, 0 } },
+		[33] = { { 37, 37, 7, 3 }, { 0, 0, 0, 0 } },
+		[34] = { { 37, 37, 7, 3 }, { 0, 0, 0, 0 } },
+		[35] = { { 37, 37, 7, 3 }, { 0, 0, 0, 0 } },
+		[36] = { { 37, 37, 7, 3 }, { 0, 0, 0, 0 } },
+	},
+	[22] = {
+		[0] = { { 37, 37, 5, 3 }, { 0, 0, 0, 0 } },
+		[1] = { { 479, 562, 5, 3 }, { 562, 2, 12, 3 } },
+		[2] = { { 481, 563, 5, 3 }, { 563, 4, 12, 3 } },
+		[3] = { { 479, 564, 5, 3 }, { 564, 6, 7, 3 } },
+		[4] = { { 481, 565, 5, 3 }, { 565, 8, 7, 3 } },
+		[5] = { { 485, 566, 5, 3 }, { 566, 10, 7, 3 } },
+		[6] = { { 486, 567, 5, 3 }, { 567, 12, 7, 3 } },
+		[7] = { { 487, 568, 5, 3 }, { 568, 14, 7, 3 } },
+		[8] = { { 489, 569, 5, 3 }, { 569, 16, 7, 3 } },
+		[9] = { { 490, 570, 5, 3 }, { 570, 18, 7, 3 } },
+		[10] = { { 492, 571, 5, 3 }, { 571, 20, 7, 3 } },
+		[11] = { { 481, 572, 5, 3 }, { 572, 22, 7, 3 } },
+		[12] = { { 495, 573, 5, 3 }, { 573, 24, 7, 3 } },
+		[13] = { { 497, 574, 5, 3 }, { 574, 26, 7, 3 } },
+		[14] = { { 499, 575, 5, 3 }, { 575, 28, 7, 3 } },
+		[15] = { { 501, 576, 5, 3 }, { 576, 30, 7, 3 } },
+		[16] = { { 503, 577, 5, 3 }, { 577, 32, 7, 3 } },
+		[17] = { { 505, 578, 5, 3 }, { 578, 34, 6, 3 } },
+		[18] = { { 37, 579, 5, 3 }, { 579, 36, 6, 3 } },
+		[19] = { { 37, 37, 5, 3 }, { 37, 38, 7, 3 } },
+		[20] = { { 37, 37, 5, 3 }, { 37, 38, 7, 3 } },
+		[21] = { { 37, 37, 5, 3 }, { 37, 38, 7, 3 } },
+		[22] = { { 37, 37, 5, 3 }, { 37, 38, 5, 3 } },
+		[23] = { { 37, 37, 5, 3 }, { 37, 38, 7, 0 } },
+		[24] = { { 37, 37, 5, 3 }, { 37, 38, 5, 3 } },
+		[25] = { { 37, 37, 5, 3 }, { 37, 38, 7, 0 } },
+		[26] = { { 37, 37, 5, 3 }, { 37, 38, 5, 3 } },
+		[27] = { { 37, 37, 5, 3 }, { 37, 38, 7, 0 } },
+		[28] = { { 37, 37, 5, 3 }, { 0, 0, 0, 0 } },
+		[29] = { { 37, 37, 5, 3 }, { 0, 0, 0, 0 } },
+		[30] = { { 37, 37, 5, 3 }, { 0, 0, 0, 0 } },
+		[31] = { { 37, 37, 5, 3 }, { 0, 0, 0, 0 } },
+		[32] = { { 37, 37, 5, 3 }, { 0, 0, 0, 0 } },
+		[33] = { { 37, 37, 5, 3 }, { 0, 0, 0, 0 } },
+		[34] = { { 37, 37, 5, 3 }, { 0, 0, 0, 0 } },
+		[35] = { { 37, 37, 5, 3 }, { 0, 0, 0, 0 } },
+		[36] = { { 37, 37, 5, 3 }, { 0, 0, 0, 0 } },
+	},
+	[23] = {
+		[0] = { { 37, 37, 7, 1 }, { 0, 0, 0, 0 } },
+		[1] = { { 479, 480, 7, 1 }, { 480, 2, 12, 3 } },
+		[2] = { { 481, 482, 7, 1 }, { 482, 4, 12, 3 } },
+		[3] = { { 479, 483, 7, 1 }, { 483, 6, 7, 3 } },
+		[4] = { { 481, 484, 7, 1 }, { 484, 8, 7, 3 } },
+		[5] = { { 485, 153, 7, 1 }, { 153, 10, 7, 3 } },
+		[6] = { { 486, 178, 7, 1 }, { 178, 12, 7, 3 } },
+		[7] = { { 487, 488, 7, 1 }, { 488, 14, 7, 3 } },
+		[8] = { { 489, 228, 7, 1 }, { 228, 16, 7, 3 } },
+		[9] = { { 490, 491, 7, 1 }, { 491, 18, 7, 3 } },
+		[10] = { { 492, 493, 7, 1 }, { 493, 20, 7, 3 } },
+		[11] = { { 481, 494, 7, 1 }, { 494, 22, 7, 3 } },
+		[12] = { { 495, 496, 7, 1 }, { 496, 24, 7, 3 } },
+		[13] = { { 497, 498, 7, 1 }, { 498, 26, 7, 3 } },
+		[14] = { { 499, 500, 7, 1 }, { 500, 28, 7, 3 } },
+		[15] = { { 501, 502, 7, 1 }, { 502, 30, 7, 3 } },
+		[16] = { { 503, 504, 7, 1 }, { 504, 32, 7, 3 } },
+		[17] = { { 505, 506, 7, 1 }, { 506, 34, 6, 3 } },
+		[18] = { { 37, 507, 7, 1 }, { 507, 36, 6, 3 } },
+		[19] = { { 37, 37, 7, 1 }, { 37, 38, 7, 3 } },
+		[20] = { { 37, 37, 7, 1 }, { 37, 38, 7, 3 } },
+		[21] = { { 37, 37, 7, 1 }, { 37, 38, 7, 3 } },
+		[22] = { { 37, 37, 7, 1 }, { 37, 38, 5, 3 } },
+		[23] = { { 37, 37, 7, 1 }, { 37, 38, 7, 0 } },
+		[24] = { { 37, 37, 7, 1 }, { 37, 38, 5, 3 } },
+		[25] = { { 37, 37, 7, 1 }, { 37, 38, 7, 0 } },
+		[26] = { { 37, 37, 7, 1 }, { 37, 38, 5, 3 } },
+		[27] = { { 37, 37, 7, 1 }, { 37, 38, 7, 0 } },
+		[28] = { { 37, 37, 7, 1 }, { 0, 0, 0, 0 } },
+		[29] = { { 37, 37, 7, 1 }, { 0, 0, 0, 0 } },
+		[30] = { { 37, 37, 7, 1 }, { 0, 0, 0, 0 } },
+		[31] = { { 37, 37, 7, 1 }, { 0, 0, 0, 0 } },
+		[32] = { { 37, 37, 7, 1 }, { 0, 0, 0, 0 } },
+		[33] = { { 37, 37, 7, 1 }, { 0, 0, 0, 0 } },
+		[34] = { { 37, 37, 7, 1 }, { 0, 0, 0, 0 } },
+		[35] = { { 37, 37, 7, 1 }, { 0, 0, 0, 0 } },
+		[36] = { { 37, 37, 7, 1 }, { 0, 0, 0, 0 } },
+	},
+	[24] = {
+		[0] = { { 37, 37, 5, 3 }, { 0, 0, 0, 0 } },
+		[1] = { { 509, 581, 5, 3 }, { 581, 2, 12, 3 } },
+		[2] = { { 511, 582, 5, 3 }, { 582, 4, 12, 3 } },
+		[3] = { { 509, 583, 5, 3 }, { 583, 6, 7, 3 } },
+		[4] = { { 511, 584, 5, 3 }, { 584, 8, 7, 3 } },
+		[5] = { { 515, 160, 5, 3 }, { 160, 10, 7, 3 } },
+		[6] = { { 516, 585, 5, 3 }, { 585, 12, 7, 3 } },
+		[7] = { { 517, 586, 5, 3 }, { 586, 14, 7, 3 } },
+		[8] = { { 519, 587, 5, 3 }, { 587, 16, 7, 3 } },
+		[9] = { { 520, 588, 5, 3 }, { 588, 18, 7, 3 } },
+		[10] = { { 522, 589, 5, 3 }, { 589, 20, 7, 3 } },
+		[11] = { { 511, 590, 5, 3 }, { 590, 22, 7, 3 } },
+		[12] = { { 525, 591, 5, 3 }, { 591, 24, 7, 3 } },
+		[13] = { { 527, 592, 5, 3 }, { 592, 26, 7, 3 } },
+		[14] = { { 529, 593, 5, 3 }, { 593, 28, 7, 3 } },
+		[15] = { { 531, 594, 5, 3 }, { 594, 30, 7, 3 } },
+		[16] = { { 533, 595, 5, 3 }, { 595, 32, 7, 3 } },
+		[17] = { { 535, 596, 5, 3 }, { 596, 34, 6, 3 } },
+		[18] = { { 37, 579, 5, 3 }, { 579, 36, 6, 3 } },
+		[19] = { { 37, 37, 5, 3 }, { 37, 38, 7, 3 } },
+		[20] = { { 37, 37, 5, 3 }, { 37, 38, 7, 3 } },
+		[21] = { { 37, 37, 5, 3 }, { 37, 38, 7, 3 } },
+		[22] = { { 37, 37, 5, 3 }, { 37, 38, 5, 3 } },
+		[23] = { { 37, 37, 5, 3 }, { 37, 38, 7, 0 } },
+		[24] = { { 37, 37, 5, 3 }, { 37, 38, 5, 3 } },
+		[25] = { { 37, 37, 5, 3 }, { 37, 38, 7, 0 } },
+		[26] = { { 37, 37, 5, 3 }, { 37, 38, 5, 3 } },
+		[27] = { { 37, 37, 5, 3 }, { 37, 38, 7, 0 } },
+		[28] = { { 37, 37, 5, 3 }, { 0, 0, 0, 0 } },
+		[29] = { { 37, 37, 5, 3 }, { 0, 0, 0, 0 } },
+		[30] = { { 37, 37, 5, 3 }, { 0, 0, 0, 0 } },
+		[31] = { { 37, 37, 5, 3 }, { 0, 0, 0, 0 } },
+		[32] = { { 37, 37, 5, 3 }, { 0, 0, 0, 0 } },
+		[33] = { { 37, 37, 5, 3 }, { 0, 0, 0, 0 } },
+		[34] = { { 37, 37, 5, 3 }, { 0, 0, 0, 0 } },
+		[35] = { { 37, 37, 5, 3 }, { 0, 0, 0, 0 } },
+		[36] = { { 37, 37, 5, 3 }, { 0, 0, 0, 0 } },
+	},
+	[25] = {
+		[0] = { { 37, 37, 7, 1 }, { 0, 0, 0, 0 } },
+		[1] = { { 509, 510, 7, 1 }, { 510, 2, 12, 3 } },
+		[2] = { { 511, 512, 7, 1 }, { 512, 4, 12, 3 } },
+		[3] = { { 509, 513, 7, 1 }, { 513, 6, 7, 3 } },
+		[4] = { { 511, 514, 7, 1 }, { 514, 8, 7, 3 } },
+		[5] = { { 515, 155, 7, 1 }, { 155, 10, 7, 3 } },
+		[6] = { { 516, 180, 7, 1 }, { 180, 12, 7, 3 } },
+		[7] = { { 517, 518, 7, 1 }, { 518, 14, 7, 3 } },
+		[8] = { { 519, 230, 7, 1 }, { 230, 16, 7, 3 } },
+		[9] = { { 520, 521, 7, 1 }, { 521, 18, 7, 3 } },
+		[10] = { { 522, 523, 7, 1 }, { 523, 20, 7, 3 } },
+		[11] = { { 511, 524, 7, 1 }, { 524, 22, 7, 3 } },
+		[12] = { { 525, 526, 7, 1 }, { 526, 24, 7, 3 } },
+		[13] = { { 527, 528, 7, 1 }, { 528, 26, 7, 3 } },
+		[14] = { { 529, 530, 7, 1 }, { 530, 28, 7, 3 } },
+		[15] = { { 531, 532, 7, 1 }, { 532, 30, 7, 3 } },
+		[16] = { { 533, 534, 7, 1 }, { 534, 32, 7, 3 } },
+		[17] = { { 535, 536, 7, 1 }, { 536, 34, 6, 3 } },
+		[18] = { { 37, 507, 7, 1 }, { 507, 36, 6, 3 } },
+		[19] = { { 37, 37, 7, 1 }, { 37, 38, 7, 3 } },
+		[20] = { { 37, 37, 7, 1 }, { 37, 38, 7, 3 } },
+		[21] = { { 37, 37, 7, 1 }, { 37, 38, 7, 3 } },
+		[22] = { { 37, 37, 7, 1 }, { 37, 38, 5, 3 } },
+		[23] = { { 37, 37, 7, 1 }, { 37, 38, 7, 0 } },
+		[24] = { { 37, 37, 7, 1 }, { 37, 38, 5, 3 } },
+		[25] = { { 37, 37, 7, 1 }, { 37, 38, 7, 0 } },
+		[26] = { { 37, 37, 7, 1 }, { 37, 38, 5, 3 } },
+		[27] = { { 37, 37, 7, 1 }, { 37, 38, 7, 0 } },
+		[28] = { { 37, 37, 7, 1 }, { 0, 0, 0, 0 } },
+		[29] = { { 37, 37, 7, 1 }, { 0, 0, 0, 0 } },
+		[30] = { { 37, 37, 7, 1 }, { 0, 0, 0, 0 } },
+		[31] = { { 37, 37, 7, 1 }, { 0, 0, 0, 0 } },
+		[32] = { { 37, 37, 7, 1 }, { 0, 0, 0, 0 } },
+		[33] = { { 37, 37, 7, 1 }, { 0, 0, 0, 0 } },
+		[34] = { { 37, 37, 7, 1 }, { 0, 0, 0, 0 } },
+		[35] = { { 37, 37, 7, 1 }, { 0, 0, 0, 0 } },
+		[36] = { { 37, 37, 7, 1 }, { 0, 0, 0, 0 } },
+	},
+	[26] = {
+		[0] = { { 37, 37, 5, 3 }, { 0, 0, 0, 0 } },
+		[1] = { { 538, 598, 5, 3 }, { 598, 2, 12, 3 } },
+		[2] = { { 540, 599, 5, 3 }, { 599, 4, 12, 3 } },
+		[3] = { { 538, 600, 5, 3 }, { 600, 6, 7, 3 } },
+		[4] = { { 540, 601, 5, 3 }, { 601, 8, 7, 3 } },
+		[5] = { { 544, 602, 5, 3 }, { 602, 10, 7, 3 } },
+		[6] = { { 540, 603, 5, 3 }, { 603, 12, 7, 3 } },
+		[7] = { { 544, 604, 5, 3 }, { 604, 14, 7, 3 } },
+		[8] = { { 540, 605, 5, 3 }, { 605, 16, 7, 3 } },
+		[9] = { { 540, 606, 5, 3 }, { 606, 18, 7, 3 } },
+		[10] = { { 540, 607, 5, 3 }, { 607, 20, 7, 3 } },
+		[11] = { { 550, 608, 5, 3 }, { 608, 22, 7, 3 } },
+		[12] = { { 544, 609, 5, 3 }, { 609, 24, 7, 3 } },
+		[13] = { { 540, 610, 5, 3 }, { 610, 26, 7, 3 } },
+		[14] = { { 544, 611, 5, 3 }, { 611, 28, 7, 3 } },
+		[15] = { { 555, 612, 5, 3 }, { 612, 30, 7, 3 } },
+		[16] = { { 557, 613, 5, 3 }, { 613, 32, 7, 3 } },
+		[17] = { { 559, 614, 5, 3 }, { 614, 34, 6, 3 } },
+		[18] = { { 37, 579, 5, 3 }, { 579, 36, 6, 3 } },
+		[19] = { { 37, 37, 5, 3 }, { 37, 38, 7, 3 } },
+		[20] = { { 37, 37, 5, 3 }, { 37, 38, 7, 3 } },
+		[21] = { { 37, 37, 5, 3 }, { 37, 38, 7, 3 } },
+		[22] = { { 37, 37, 5, 3 }, { 37, 38, 5, 3 } },
+		[23] = { { 37, 37, 5, 3 }, { 37, 38, 7, 0 } },
+		[24] = { { 37, 37, 5, 3 }, { 37, 38, 5, 3 } },
+		[25] = { { 37, 37, 5, 3 }, { 37, 38, 7, 0 } },
+		[26] = { { 37, 37, 5, 3 }, { 37, 38, 5, 3 } },
+		[27] = { { 37, 37, 5, 3 }, { 37, 38, 7, 0 } },
+		[28] = { { 37, 37, 5, 3 }, { 0, 0, 0, 0 } },
+		[29] = { { 37, 37, 5, 3 }, { 0, 0, 0, 0 } },
+		[30] = { { 37, 37, 5, 3 }, { 0, 0, 0, 0 } },
+		[31] = { { 37, 37, 5, 3 }, { 0, 0, 0, 0 } },
+		[32] = { { 37, 37, 5, 3 }, { 0, 0, 0, 0 } },
+		[33] = { { 37, 37, 5, 3 }, { 0, 0, 0, 0 } },
+		[34] = { { 37, 37, 5, 3 }, { 0, 0, 0, 0 } },
+		[35] = { { 37, 37, 5, 3 }, { 0, 0, 0, 0 } },
+		[36] = { { 37, 37, 5, 3 }, { 0, 0, 0, 0 } },
+	},
+	[27] = {
+		[0] = { { 37, 37, 7, 1 }, { 0, 0, 0, 0 } },
+		[1] = { { 538, 539, 7, 1 }, { 539, 2, 12, 3 } },
+		[2] = { { 540, 541, 7, 1 }, { 541, 4, 12, 3 } },
+		[3] = { { 538, 542, 7, 1 }, { 542, 6, 7, 3 } },
+		[4] = { { 540, 543, 7, 1 }, { 543, 8, 7, 3 } },
+		[5] = { { 544, 545, 7, 1 }, { 545, 10, 7, 3 } },
+		[6] = { { 540, 546, 7, 1 }, { 546, 12, 7, 3 } },
+		[7] = { { 544, 547, 7, 1 }, { 547, 14, 7, 3 } },
+		[8] = { { 540, 548, 7, 1 }, { 548, 16, 7, 3 } },
+		[9] = { { 540, 256, 7, 1 }, { 256, 18, 7, 3 } },
+		[10] = { { 540, 549, 7, 1 }, { 549, 20, 7, 3 } },
+		[11] = { { 550, 551, 7, 1 }, { 551, 22, 7, 3 } },
+		[12] = { { 544, 552, 7, 1 }, { 552, 24, 7, 3 } },
+		[13] = { { 540, 553, 7, 1 }, { 553, 26, 7, 3 } },
+		[14] = { { 544, 554, 7, 1 }, { 554, 28, 7, 3 } },
+		[15] = { { 555, 556, 7, 1 }, { 556, 30, 7, 3 } },
+		[16] = { { 557, 558, 7, 1 }, { 558, 32, 7, 3 } },
+		[17] = { { 559, 560, 7, 1 }, { 560, 34, 6, 3 } },
+		[18] = { { 37, 507, 7, 1 }, { 507, 36, 6, 3 } },
+		[19] = { { 37, 37, 7, 1 }, { 37, 38, 7, 3 } },
+		[20] = { { 37, 37, 7, 1 }, { 37, 38, 7, 3 } },
+		[21] = { { 37, 37, 7, 1 }, { 37, 38, 7, 3 } },
+		[22] = { { 37, 37, 7, 1 }, { 37, 38, 5, 3 } },
+		[23] = { { 37, 37, 7, 1 }, { 37, 38, 7, 0 } },
+		[24] = { { 37, 37, 7, 1 }, { 37, 38, 5, 3 } },
+		[25] = { { 37, 37, 7, 1 }, { 37, 38, 7, 0 } },
+		[26] = { { 37, 37, 7, 1 }, { 37, 38, 5, 3 } },
+		[27] = { { 37, 37, 7, 1 }, { 37, 38, 7, 0 } },
+		[28] = { { 37, 37, 7, 1 }, { 0, 0, 0, 0 } },
+		[29] = { { 37, 37, 7, 1 }, { 0, 0, 0, 0 } },
+		[30] = { { 37, 37, 7, 1 }, { 0, 0, 0, 0 } },
+		[31] = { { 37, 37, 7, 1 }, { 0, 0, 0, 0 } },
+		[32] = { { 37, 37, 7, 1 }, { 0, 0, 0, 0 } },
+		[33] = { { 37, 37, 7, 1 }, { 0, 0, 0, 0 } },
+		[34] = { { 37, 37, 7, 1 }, { 0, 0, 0, 0 } },
+		[35] = { { 37, 37, 7, 1 }, { 0, 0, 0, 0 } },
+		[36] = { { 37, 37, 7, 1 }, { 0, 0, 0, 0 } },
+	},
+	[28] = {
+		[0] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[1] = { { 0, 0, 0, 0 }, { 1, 2, 12, 3 } },
+		[2] = { { 0, 0, 0, 0 }, { 3, 4, 12, 3 } },
+		[3] = { { 0, 0, 0, 0 }, { 5, 6, 7, 3 } },
+		[4] = { { 0, 0, 0, 0 }, { 7, 8, 7, 3 } },
+		[5] = { { 0, 0, 0, 0 }, { 9, 10, 7, 3 } },
+		[6] = { { 0, 0, 0, 0 }, { 11, 12, 7, 3 } },
+		[7] = { { 0, 0, 0, 0 }, { 13, 14, 7, 3 } },
+		[8] = { { 0, 0, 0, 0 }, { 15, 16, 7, 3 } },
+		[9] = { { 0, 0, 0, 0 }, { 17, 18, 7, 3 } },
+		[10] = { { 0, 0, 0, 0 }, { 19, 20, 7, 3 } },
+		[11] = { { 0, 0, 0, 0 }, { 21, 22, 7, 3 } },
+		[12] = { { 0, 0, 0, 0 }, { 23, 24, 7, 3 } },
+		[13] = { { 0, 0, 0, 0 }, { 25, 26, 7, 3 } },
+		[14] = { { 0, 0, 0, 0 }, { 27, 28, 7, 3 } },
+		[15] = { { 0, 0, 0, 0 }, { 29, 30, 7, 3 } },
+		[16] = { { 0, 0, 0, 0 }, { 31, 32, 7, 3 } },
+		[17] = { { 0, 0, 0, 0 }, { 33, 34, 6, 3 } },
+		[18] = { { 0, 0, 0, 0 }, { 35, 36, 6, 3 } },
+		[19] = { { 0, 0, 0, 0 }, { 37, 38, 7, 3 } },
+		[20] = { { 0, 0, 0, 0 }, { 37, 38, 7, 3 } },
+		[21] = { { 0, 0, 0, 0 }, { 37, 38, 7, 3 } },
+		[22] = { { 0, 0, 0, 0 }, { 37, 38, 5, 3 } },
+		[23] = { { 0, 0, 0, 0 }, { 37, 38, 7, 0 } },
+		[24] = { { 0, 0, 0, 0 }, { 37, 38, 5, 3 } },
+		[25] = { { 0, 0, 0, 0 }, { 37, 38, 7, 0 } },
+		[26] = { { 0, 0, 0, 0 }, { 37, 38, 5, 3 } },
+		[27] = { { 0, 0, 0, 0 }, { 37, 38, 7, 0 } },
+		[28] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[29] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[30] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[31] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[32] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[33] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[34] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[35] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[36] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+	},
+	[29] = {
+		[0] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[1] = { { 0, 0, 0, 0 }, { 1, 2, 12, 3 } },
+		[2] = { { 0, 0, 0, 0 }, { 3, 4, 12, 3 } },
+		[3] = { { 0, 0, 0, 0 }, { 5, 6, 7, 3 } },
+		[4] = { { 0, 0, 0, 0 }, { 7, 8, 7, 3 } },
+		[5] = { { 0, 0, 0, 0 }, { 9, 10, 7, 3 } },
+		[6] = { { 0, 0, 0, 0 }, { 11, 12, 7, 3 } },
+		[7] = { { 0, 0, 0, 0 }, { 13, 14, 7, 3 } },
+		[8] = { { 0, 0, 0, 0 }, { 15, 16, 7, 3 } },
+		[9] = { { 0, 0, 0, 0 }, { 17, 18, 7, 3 } },
+		[10] = { { 0, 0, 0, 0 }, { 19, 20, 7, 3 } },
+		[11] = { { 0, 0, 0, 0 }, { 21, 22, 7, 3 } },
+		[12] = { { 0, 0, 0, 0 }, { 23, 24, 7, 3 } },
+		[13] = { { 0, 0, 0, 0 }, { 25, 26, 7, 3 } },
+		[14] = { { 0, 0, 0, 0 }, { 27, 28, 7, 3 } },
+		[15] = { { 0, 0, 0, 0 }, { 29, 30, 7, 3 } },
+		[16] = { { 0, 0, 0, 0 }, { 31, 32, 7, 3 } },
+		[17] = { { 0, 0, 0, 0 }, { 33, 34, 6, 3 } },
+		[18] = { { 0, 0, 0, 0 }, { 35, 36, 6, 3 } },
+		[19] = { { 0, 0, 0, 0 }, { 37, 38, 7, 3 } },
+		[20] = { { 0, 0, 0, 0 }, { 37, 38, 7, 3 } },
+		[21] = { { 0, 0, 0, 0 }, { 37, 38, 7, 3 } },
+		[22] = { { 0, 0, 0, 0 }, { 37, 38, 5, 3 } },
+		[23] = { { 0, 0, 0, 0 }, { 37, 38, 7, 0 } },
+		[24] = { { 0, 0, 0, 0 }, { 37, 38, 5, 3 } },
+		[25] = { { 0, 0, 0, 0 }, { 37, 38, 7, 0 } },
+		[26] = { { 0, 0, 0, 0 }, { 37, 38, 5, 3 } },
+		[27] = { { 0, 0, 0, 0 }, { 37, 38, 7, 0 } },
+		[28] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[29] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[30] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[31] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[32] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[33] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[34] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[35] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[36] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+	},
+	[30] = {
+		[0] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[1] = { { 0, 0, 0, 0 }, { 1, 2, 12, 3 } },
+		[2] = { { 0, 0, 0, 0 }, { 3, 4, 12, 3 } },
+		[3] = { { 0, 0, 0, 0 }, { 5, 6, 7, 3 } },
+		[4] = { { 0, 0, 0, 0 }, { 7, 8, 7, 3 } },
+		[5] = { { 0, 0, 0, 0 }, { 9, 10, 7, 3 } },
+		[6] = { { 0, 0, 0, 0 }, { 11, 12, 7, 3 } },
+		[7] = { { 0, 0, 0, 0 }, { 13, 14, 7, 3 } },
+		[8] = { { 0, 0, 0, 0 }, { 15, 16, 7, 3 } },
+		[9] = { { 0, 0, 0, 0 }, { 17, 18, 7, 3 } },
+		[10] = { { 0, 0, 0, 0 }, { 19, 20, 7, 3 } },
+		[11] = { { 0, 0, 0, 0 }, { 21, 22, 7, 3 } },
+		[12] = { { 0, 0, 0, 0 }, { 23, 24, 7, 3 } },
+		[13] = { { 0, 0, 0, 0 }, { 25, 26, 7, 3 } },
+		[14] = { { 0, 0, 0, 0 }, { 27, 28, 7, 3 } },
+		[15] = { { 0, 0, 0, 0 }, { 29, 30, 7, 3 } },
+		[16] = { { 0, 0, 0, 0 }, { 31, 32, 7, 3 } },
+		[17] = { { 0, 0, 0, 0 }, { 33, 34, 6, 3 } },
+		[18] = { { 0, 0, 0, 0 }, { 35, 36, 6, 3 } },
+		[19] = { { 0, 0, 0, 0 }, { 37, 38, 7, 3 } },
+		[20] = { { 0, 0, 0, 0 }, { 37, 38, 7, 3 } },
+		[21] = { { 0, 0, 0, 0 }, { 37, 38, 7, 3 } },
+		[22] = { { 0, 0, 0, 0 }, { 37, 38, 5, 3 } },
+		[23] = { { 0, 0, 0, 0 }, { 37, 38, 7, 0 } },
+		[24] = { { 0, 0, 0, 0 }, { 37, 38, 5, 3 } },
+		[25] = { { 0, 0, 0, 0 }, { 37, 38, 7, 0 } },
+		[26] = { { 0, 0, 0, 0 }, { 37, 38, 5, 3 } },
+		[27] = { { 0, 0, 0, 0 }, { 37, 38, 7, 0 } },
+		[28] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[29] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[30] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[31] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[32] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[33] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[34] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[35] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[36] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+	},
+	[31] = {
+		[0] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[1] = { { 0, 0, 0, 0 }, { 1, 2, 12, 3 } },
+		[2] = { { 0, 0, 0, 0 }, { 3, 4, 12, 3 } },
+		[3] = { { 0, 0, 0, 0 }, { 5, 6, 7, 3 } },
+		[4] = { { 0, 0, 0, 0 }, { 7, 8, 7, 3 } },
+		[5] = { { 0, 0, 0, 0 }, { 9, 10, 7, 3 } },
+		[6] = { { 0, 0, 0, 0 }, { 11, 12, 7, 3 } },
+		[7] = { { 0, 0, 0, 0 }, { 13, 14, 7, 3 } },
+		[8] = { { 0, 0, 0, 0 }, { 15, 16, 7, 3 } },
+		[9] = { { 0, 0, 0, 0 }, { 17, 18, 7, 3 } },
+		[10] = { { 0, 0, 0, 0 }, { 19, 20, 7, 3 } },
+		[11] = { { 0, 0, 0, 0 }, { 21, 22, 7, 3 } },
+		[12] = { { 0, 0, 0, 0 }, { 23, 24, 7, 3 } },
+		[13] = { { 0, 0, 0, 0 }, { 25, 26, 7, 3 } },
+		[14] = { { 0, 0, 0, 0 }, { 27, 28, 7, 3 } },
+		[15] = { { 0, 0, 0, 0 }, { 29, 30, 7, 3 } },
+		[16] = { { 0, 0, 0, 0 }, { 31, 32, 7, 3 } },
+		[17] = { { 0, 0, 0, 0 }, { 33, 34, 6, 3 } },
+		[18] = { { 0, 0, 0, 0 }, { 35, 36, 6, 3 } },
+		[19] = { { 0, 0, 0, 0 }, { 37, 38, 7, 3 } },
+		[20] = { { 0, 0, 0, 0 }, { 37, 38, 7, 3 } },
+		[21] = { { 0, 0, 0, 0 }, { 37, 38, 7, 3 } },
+		[22] = { { 0, 0, 0, 0 }, { 37, 38, 5, 3 } },
+		[23] = { { 0, 0, 0, 0 }, { 37, 38, 7, 0 } },
+		[24] = { { 0, 0, 0, 0 }, { 37, 38, 5, 3 } },
+		[25] = { { 0, 0, 0, 0 }, { 37, 38, 7, 0 } },
+		[26] = { { 0, 0, 0, 0 }, { 37, 38, 5, 3 } },
+		[27] = { { 0, 0, 0, 0 }, { 37, 38, 7, 0 } },
+		[28] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[29] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[30] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[31] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[32] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[33] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[34] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[35] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[36] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+	},
+	[32] = {
+		[0] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[1] = { { 0, 0, 0, 0 }, { 1, 2, 12, 3 } },
+		[2] = { { 0, 0, 0, 0 }, { 3, 4, 12, 3 } },
+		[3] = { { 0, 0, 0, 0 }, { 5, 6, 7, 3 } },
+		[4] = { { 0, 0, 0, 0 }, { 7, 8, 7, 3 } },
+		[5] = { { 0, 0, 0, 0 }, { 9, 10, 7, 3 } },
+		[6] = { { 0, 0, 0, 0 }, { 11, 12, 7, 3 } },
+		[7] = { { 0, 0, 0, 0 }, { 13, 14, 7, 3 } },
+		[8] = { { 0, 0, 0, 0 }, { 15, 16, 7, 3 } },
+		[9] = { { 0, 0, 0, 0 }, { 17, 18, 7, 3 } },
+		[10] = { { 0, 0, 0, 0 }, { 19, 20, 7, 3 } },
+		[11] = { { 0, 0, 0, 0 }, { 21, 22, 7, 3 } },
+		[12] = { { 0, 0, 0, 0 }, { 23, 24, 7, 3 } },
+		[13] = { { 0, 0, 0, 0 }, { 25, 26, 7, 3 } },
+		[14] = { { 0, 0, 0, 0 }, { 27, 28, 7, 3 } },
+		[15] = { { 0, 0, 0, 0 }, { 29, 30, 7, 3 } },
+		[16] = { { 0, 0, 0, 0 }, { 31, 32, 7, 3 } },
+		[17] = { { 0, 0, 0, 0 }, { 33, 34, 6, 3 } },
+		[18] = { { 0, 0, 0, 0 }, { 35, 36, 6, 3 } },
+		[19] = { { 0, 0, 0, 0 }, { 37, 38, 7, 3 } },
+		[20] = { { 0, 0, 0, 0 }, { 37, 38, 7, 3 } },
+		[21] = { { 0, 0, 0, 0 }, { 37, 38, 7, 3 } },
+		[22] = { { 0, 0, 0, 0 }, { 37, 38, 5, 3 } },
+		[23] = { { 0, 0, 0, 0 }, { 37, 38, 7, 0 } },
+		[24] = { { 0, 0, 0, 0 }, { 37, 38, 5, 3 } },
+		[25] = { { 0, 0, 0, 0 }, { 37, 38, 7, 0 } },
+		[26] = { { 0, 0, 0, 0 }, { 37, 38, 5, 3 } },
+		[27] = { { 0, 0, 0, 0 }, { 37, 38, 7, 0 } },
+		[28] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[29] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[30] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[31] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[32] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[33] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[34] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[35] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[36] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+	},
+	[33] = {
+		[0] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[1] = { { 0, 0, 0, 0 }, { 1, 2, 12, 3 } },
+		[2] = { { 0, 0, 0, 0 }, { 3, 4, 12, 3 } },
+		[3] = { { 0, 0, 0, 0 }, { 5, 6, 7, 3 } },
+		[4] = { { 0, 0, 0, 0 }, { 7, 8, 7, 3 } },
+		[5] = { { 0, 0, 0, 0 }, { 9, 10, 7, 3 } },
+		[6] = { { 0, 0, 0, 0 }, { 11, 12, 7, 3 } },
+		[7] = { { 0, 0, 0, 0 }, { 13, 14, 7, 3 } },
+		[8] = { { 0, 0, 0, 0 }, { 15, 16, 7, 3 } },
+		[9] = { { 0, 0, 0, 0 }, { 17, 18, 7, 3 } },
+		[10] = { { 0, 0, 0, 0 }, { 19, 20, 7, 3 } },
+		[11] = { { 0, 0, 0, 0 }, { 21, 22, 7, 3 } },
+		[12] = { { 0, 0, 0, 0 }, { 23, 24, 7, 3 } },
+		[13] = { { 0, 0, 0, 0 }, { 25, 26, 7, 3 } },
+		[14] = { { 0, 0, 0, 0 }, { 27, 28, 7, 3 } },
+		[15] = { { 0, 0, 0, 0 }, { 29, 30, 7, 3 } },
+		[16] = { { 0, 0, 0, 0 }, { 31, 32, 7, 3 } },
+		[17] = { { 0, 0, 0, 0 }, { 33, 34, 6, 3 } },
+		[18] = { { 0, 0, 0, 0 }, { 35, 36, 6, 3 } },
+		[19] = { { 0, 0, 0, 0 }, { 37, 38, 7, 3 } },
+		[20] = { { 0, 0, 0, 0 }, { 37, 38, 7, 3 } },
+		[21] = { { 0, 0, 0, 0 }, { 37, 38, 7, 3 } },
+		[22] = { { 0, 0, 0, 0 }, { 37, 38, 5, 3 } },
+		[23] = { { 0, 0, 0, 0 }, { 37, 38, 7, 0 } },
+		[24] = { { 0, 0, 0, 0 }, { 37, 38, 5, 3 } },
+		[25] = { { 0, 0, 0, 0 }, { 37, 38, 7, 0 } },
+		[26] = { { 0, 0, 0, 0 }, { 37, 38, 5, 3 } },
+		[27] = { { 0, 0, 0, 0 }, { 37, 38, 7, 0 } },
+		[28] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[29] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[30] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[31] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[32] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[33] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[34] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[35] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[36] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+	},
+	[34] = {
+		[0] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[1] = { { 0, 0, 0, 0 }, { 1, 2, 12, 3 } },
+		[2] = { { 0, 0, 0, 0 }, { 3, 4, 12, 3 } },
+		[3] = { { 0, 0, 0, 0 }, { 5, 6, 7, 3 } },
+		[4] = { { 0, 0, 0, 0 }, { 7, 8, 7, 3 } },
+		[5] = { { 0, 0, 0, 0 }, { 9, 10, 7, 3 } },
+		[6] = { { 0, 0, 0, 0 }, { 11, 12, 7, 3 } },
+		[7] = { { 0, 0, 0, 0 }, { 13, 14, 7, 3 } },
+		[8] = { { 0, 0, 0, 0 }, { 15, 16, 7, 3 } },
+		[9] = { { 0, 0, 0, 0 }, { 17, 18, 7, 3 } },
+		[10] = { { 0, 0, 0, 0 }, { 19, 20, 7, 3 } },
+		[11] = { { 0, 0, 0, 0 }, { 21, 22, 7, 3 } },
+		[12] = { { 0, 0, 0, 0 }, { 23, 24, 7, 3 } },
+		[13] = { { 0, 0, 0, 0 }, { 25, 26, 7, 3 } },
+		[14] = { { 0, 0, 0, 0 }, { 27, 28, 7, 3 } },
+		[15] = { { 0, 0, 0, 0 }, { 29, 30, 7, 3 } },
+		[16] = { { 0, 0, 0, 0 }, { 31, 32, 7, 3 } },
+		[17] = { { 0, 0, 0, 0 }, { 33, 34, 6, 3 } },
+		[18] = { { 0, 0, 0, 0 }, { 35, 36, 6, 3 } },
+		[19] = { { 0, 0, 0, 0 }, { 37, 38, 7, 3 } },
+		[20] = { { 0, 0, 0, 0 }, { 37, 38, 7, 3 } },
+		[21] = { { 0, 0, 0, 0 }, { 37, 38, 7, 3 } },
+		[22] = { { 0, 0, 0, 0 }, { 37, 38, 5, 3 } },
+		[23] = { { 0, 0, 0, 0 }, { 37, 38, 7, 0 } },
+		[24] = { { 0, 0, 0, 0 }, { 37, 38, 5, 3 } },
+		[25] = { { 0, 0, 0, 0 }, { 37, 38, 7, 0 } },
+		[26] = { { 0, 0, 0, 0 }, { 37, 38, 5, 3 } },
+		[27] = { { 0, 0, 0, 0 }, { 37, 38, 7, 0 } },
+		[28] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[29] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[30] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[31] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[32] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[33] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[34] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[35] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[36] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+	},
+	[35] = {
+		[0] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[1] = { { 0, 0, 0, 0 }, { 1, 2, 12, 3 } },
+		[2] = { { 0, 0, 0, 0 }, { 3, 4, 12, 3 } },
+		[3] = { { 0, 0, 0, 0 }, { 5, 6, 7, 3 } },
+		[4] = { { 0, 0, 0, 0 }, { 7, 8, 7, 3 } },
+		[5] = { { 0, 0, 0, 0 }, { 9, 10, 7, 3 } },
+		[6] = { { 0, 0, 0, 0 }, { 11, 12, 7, 3 } },
+		[7] = { { 0, 0, 0, 0 }, { 13, 14, 7, 3 } },
+		[8] = { { 0, 0, 0, 0 }, { 15, 16, 7, 3 } },
+		[9] = { { 0, 0, 0, 0 }, { 17, 18, 7, 3 } },
+		[10] = { { 0, 0, 0, 0 }, { 19, 20, 7, 3 } },
+		[11] = { { 0, 0, 0, 0 }, { 21, 22, 7, 3 } },
+		[12] = { { 0, 0, 0, 0 }, { 23, 24, 7, 3 } },
+		[13] = { { 0, 0, 0, 0 }, { 25, 26, 7, 3 } },
+		[14] = { { 0, 0, 0, 0 }, { 27, 28, 7, 3 } },
+		[15] = { { 0, 0, 0, 0 }, { 29, 30, 7, 3 } },
+		[16] = { { 0, 0, 0, 0 }, { 31, 32, 7, 3 } },
+		[17] = { { 0, 0, 0, 0 }, { 33, 34, 6, 3 } },
+		[18] = { { 0, 0, 0, 0 }, { 35, 36, 6, 3 } },
+		[19] = { { 0, 0, 0, 0 }, { 37, 38, 7, 3 } },
+		[20] = { { 0, 0, 0, 0 }, { 37, 38, 7, 3 } },
+		[21] = { { 0, 0, 0, 0 }, { 37, 38, 7, 3 } },
+		[22] = { { 0, 0, 0, 0 }, { 37, 38, 5, 3 } },
+		[23] = { { 0, 0, 0, 0 }, { 37, 38, 7, 0 } },
+		[24] = { { 0, 0, 0, 0 }, { 37, 38, 5, 3 } },
+		[25] = { { 0, 0, 0, 0 }, { 37, 38, 7, 0 } },
+		[26] = { { 0, 0, 0, 0 }, { 37, 38, 5, 3 } },
+		[27] = { { 0, 0, 0, 0 }, { 37, 38, 7, 0 } },
+		[28] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[29] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[30] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[31] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[32] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[33] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[34] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[35] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+		[36] = { { 0, 0, 0, 0 }, { 0, 0, 0, 0 } },
+	},
+	[36] = {
+		[0] = { { 37, 37, 20, 1 }, { 0, 0, 0, 0 } },
+		[1] = { { 1, 37, 20, 1 }, { 1, 2, 12, 3 } },
+		[2] = { { 3, 37, 20, 1 }, { 3, 4, 12, 3 } },
+		[3] = { { 5, 37, 20, 1 }, { 5, 6, 7, 3 } },
+		[4] = { { 7, 37, 20, 1 }, { 7, 8, 7, 3 } },
+		[5] = { { 9, 37, 20, 1 }, { 9, 10, 7, 3 } },
+		[6] = { { 11, 37, 20, 1 }, { 11, 12, 7, 3 } },
+		[7] = { { 13, 37, 20, 1 }, { 13, 14, 7, 3 } },
+		[8] = { { 15, 37, 20, 1 }, { 15, 16, 7, 3 } },
+		[9] = { { 17, 37, 20, 1 }, { 17, 18, 7, 3 } },
+		[10] = { { 19, 37, 20, 1 }, { 19, 20, 7, 3 } },
+		[11] = { { 21, 37, 20, 1 }, { 21, 22, 7, 3 } },
+		[12] = { { 23, 37, 20, 1 }, { 23, 24, 7, 3 } },
+		[13] = { { 25, 37, 20, 1 }, { 25, 26, 7, 3 } },
+		[14] = { { 27, 37, 20, 1 }, { 27, 28, 7, 3 } },
+		[15] = { { 29, 37, 20, 1 }, { 29, 30, 7, 3 } },
+		[16] = { { 31, 37, 20, 1 }, { 31, 32, 7, 3 } },
+		[17] = { { 33, 37, 20, 1 }, { 33, 34, 6, 3 } },
+		[18] = { { 35, 37, 20, 1 }, { 35, 36, 6, 3 } },
+		[19] = { { 37, 37, 20, 1 }, { 37, 38, 7, 3 } },
+		[20] = { { 37, 37, 20, 1 }, { 37, 38, 7, 3 } },
+		[21] = { { 37, 37, 20, 1 }, { 37, 38, 7, 3 } },
+		[22] = { { 37, 37, 20, 1 }, { 37, 38, 5, 3 } },
+		[23] = { { 37, 37, 20, 1 }, { 37, 38, 7, 0 } },
+		[24] = { { 37, 37, 20, 1 }, { 37, 38, 5, 3 } },
+		[25] = { { 37, 37, 20, 1 }, { 37, 38, 7, 0 } },
+		[26] = { { 37, 37, 20, 1 }, { 37, 38, 5, 3 } },
+		[27] = { { 37, 37, 20, 1 }, { 37, 38, 7, 0 } },
+		[28] = { { 617, 37, 20, 1 }, { 0, 0, 0, 0 } },
+		[29] = { { 617, 37, 20, 1 }, { 0, 0, 0, 0 } },
+		[30] = { { 619, 37, 20, 1 }, { 0, 0, 0, 0 } },
+		[31] = { { 619, 37, 20, 1 }, { 0, 0, 0, 0 } },
+		[32] = { { 621, 37, 20, 1 }, { 0, 0, 0, 0 } },
+		[33] = { { 621, 37, 20, 1 }, { 0, 0, 0, 0 } },
+		[34] = { { 623, 37, 20, 1 }, { 0, 0, 0, 0 } },
+		[35] = { { 623, 37, 20, 1 }, { 0, 0, 0, 0 } },
+		[36] = { { 37, 37, 20, 1 }, { 0, 0, 0, 0 } },
+	},
+};
+
+#endif
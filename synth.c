@@ -6,6 +6,8 @@
 
 #include "juno.h"
 #include "bob.h"
+#include "track.h"
+#include "voicefile.h"
 
 #if BIG_TARGET
 #include <time.h>
@@ -107,10 +109,27 @@ done:
 	return 0;
 }
 
+static struct track_recorder recorder;
+
+static void finish_recording(void)
+{
+	if (!track_record_end(&recorder) || fclose(recorder.f) != 0)
+		fprintf(stderr, "error writing track\n");
+}
+
+static struct juno *juno = NULL;
+
+static void print_stats(void)
+{
+	struct juno_stats stats;
+	juno_get_stats(juno, &stats);
+	fprintf(stderr, "# envelopes: %lu of %lu steps\n",
+	        stats.envelopes, stats.steps);
+}
+
 // test program
 int main(int argc, char *argv[])
 {
-	struct juno *juno = NULL;
 
 	audio_init();
 	juno = juno_create();
@@ -119,9 +138,82 @@ int main(int argc, char *argv[])
 		exit(1);
 	}
 
-	juno_set_output(juno, audio_play_sample);
+	struct juno_stats stats;
+	struct juno_voice *voice = NULL; // loaded by -v
+	juno_get_stats(juno, &stats);
+	fprintf(stderr, "# render kernels: %s\n", stats.kernels);
+	fprintf(stderr, "# buzz rate: 1/%d\n", stats.buzz_decimation);
+
+	juno_set_output_block(juno, audio_play_block, NULL);
+	juno_set_output_silence(juno, audio_play_silence);
+	atexit(print_stats);
+
+	// -v file: speak with the voice in a voice file
+	// (it stays mapped until the program exits)
+	if (argc >= 3 && strcmp(argv[1], "-v") == 0) {
+		voice = juno_load_voice(argv[2]);
+		if (!voice)
+			return 1;
+		juno_set_packed_voice(juno, voice->voice);
+		argv[2] = argv[0];
+		argv += 2;
+		argc -= 2;
+	}
+
+	// -P pitch, -R rate: speak pitch half-tones higher (or lower), and
+	// at rate words per minute
+	while (argc >= 3 && (strcmp(argv[1], "-P") == 0 ||
+	                     strcmp(argv[1], "-R") == 0)) {
+		int x = atoi(argv[2]);
+		if (argv[1][1] == 'P' ? !juno_set_pitch(juno, x) :
+		                        !juno_set_rate(juno, x)) {
+			fprintf(stderr, "%s %s is out of range\n",
+			        argv[1], argv[2]);
+			return 1;
+		}
+		argv[2] = argv[0];
+		argv += 2;
+		argc -= 2;
+	}
+
+	// -r file: record a parameter track of everything spoken
+	if (argc >= 3 && strcmp(argv[1], "-r") == 0) {
+		FILE *f = fopen(argv[2], "wb");
+		int index;
+		if (!f) {
+			perror(argv[2]);
+			return 1;
+		}
+		juno_get_voice(juno, &index);
+		if (!track_record_begin(&recorder, f, index,
+		                        voice ? voice->header->name : NULL)) {
+			fprintf(stderr, "%s: cannot record a track\n", argv[2]);
+			return 1;
+		}
+		juno_set_recorder(juno, track_record, &recorder);
+		atexit(finish_recording);
+		argv[2] = argv[0];
+		argv += 2;
+		argc -= 2;
+	}
 
 	fprintf(stderr, "# argc=%d\n", argc);
+	if (argc >= 3 && argc <= 5 && strcmp(argv[1], "-p") == 0) {
+		// -p file [pitch [duration]]: play a parameter track, shifted
+		// by pitch half-tones and stretched to duration percent
+		struct track t;
+		int pitch = argc > 3 ? atoi(argv[3]) : 0;
+		int duration = argc > 4 ? atoi(argv[4]) : 100;
+		if (!track_open(&t, argv[2]))
+			return 1;
+		if (!track_play_scaled(juno, &t, pitch, duration)) {
+			fprintf(stderr, "pitch %s is out of range\n", argv[3]);
+			track_close(&t);
+			return 1;
+		}
+		track_close(&t);
+		return 0;
+	}
 	if (argc == 2) {
 		if (strcmp(argv[1], "-s") == 0) {
 			while (read_and_speak_segment(juno))
@@ -0,0 +1,215 @@
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "juno.h"
+#include "track.h"
+
+bool track_record_begin(struct track_recorder *rec, FILE *f, int voice,
+                        const char *name)
+{
+	struct track_header h = {
+		.magic = TRACK_MAGIC,
+		.version = TRACK_VERSION,
+		.header_size = sizeof h,
+		.sample_rate = SAMPLE_RATE,
+		.slices_per_second = SLICES_PER_SECOND,
+		.n_freq = N_FREQ,
+		.voice = voice >= 0 && voice < TRACK_OTHER_VOICE ?
+		         voice : TRACK_OTHER_VOICE,
+		.nslices = 0,
+	};
+	// juno only records the first step of every timeslice
+	if (FREQ_SUBSLICES > 1) {
+		fprintf(stderr, "tracks cannot be recorded with "
+		        "FREQ_SUBSLICES %d\n", FREQ_SUBSLICES);
+		return false;
+	}
+	if (name)
+		memcpy(h.voice_name, name, strnlen(name, sizeof h.voice_name - 1));
+	rec->f = f;
+	rec->nslices = 0;
+	rec->error = fwrite(&h, sizeof h, 1, f) != 1;
+	return !rec->error;
+}
+
+void track_record(void *ctx, SoundSource source, const FreqSet *freqs,
+                  int nslices)
+{
+	struct track_recorder *rec = ctx;
+	struct track_slice s = { .source = source };
+	int i;
+	for (i = 0; i < N_FREQ; ++i)
+		s.f[i] = freqs->f[i];
+	while (nslices-- > 0) {
+		if (fwrite(&s, sizeof s, 1, rec->f) != 1)
+			rec->error = true;
+		++rec->nslices;
+	}
+}
+
+bool track_record_end(struct track_recorder *rec)
+{
+	// patch the slice count into the header if we can seek back to it
+	// (otherwise it stays 0, meaning "to the end of the file")
+	long end = ftell(rec->f);
+	if (end >= 0 &&
+	    fseek(rec->f, offsetof(struct track_header, nslices), SEEK_SET) == 0) {
+		if (fwrite(&rec->nslices, sizeof rec->nslices, 1, rec->f) != 1)
+			rec->error = true;
+		fseek(rec->f, end, SEEK_SET);
+	}
+	if (fflush(rec->f) != 0)
+		rec->error = true;
+	return !rec->error;
+}
+
+bool track_open(struct track *t, const char *path)
+{
+	struct stat st;
+	int fd;
+
+	memset(t, 0, sizeof *t);
+	fd = open(path, O_RDONLY);
+	if (fd < 0 || fstat(fd, &st) < 0) {
+		fprintf(stderr, "%s: %s\n", path, strerror(errno));
+		if (fd >= 0)
+			close(fd);
+		return false;
+	}
+	if (st.st_size < sizeof *t->header) {
+		fprintf(stderr, "%s: not a track\n", path);
+		close(fd);
+		return false;
+	}
+	t->maplen = st.st_size;
+	t->map = mmap(NULL, t->maplen, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (t->map == MAP_FAILED) {
+		fprintf(stderr, "%s: %s\n", path, strerror(errno));
+		t->map = NULL;
+		return false;
+	}
+
+	const struct track_header *h = t->map;
+	const char *why = NULL;
+	if (memcmp(h->magic, TRACK_MAGIC, sizeof h->magic) != 0)
+		why = "not a track";
+	else if (h->version != TRACK_VERSION ||
+	         h->header_size < sizeof *h || h->header_size > t->maplen ||
+	         h->header_size % _Alignof(struct track_slice))
+		why = "unsupported track version or byte order";
+	else if (h->n_freq != N_FREQ)
+		why = "track has a different number of formants";
+	else if (h->sample_rate != SAMPLE_RATE ||
+	         h->slices_per_second != SLICES_PER_SECOND)
+		why = "track was recorded at a different sample or slice rate";
+	if (why) {
+		fprintf(stderr, "%s: %s\n", path, why);
+		track_close(t);
+		return false;
+	}
+
+	size_t avail = (t->maplen - h->header_size) / sizeof *t->slices;
+	const struct track_slice *slices =
+		(const void *)((const char *)t->map + h->header_size);
+	size_t nslices = h->nslices ? h->nslices : avail;
+	size_t i;
+	if (nslices > avail) {
+		fprintf(stderr, "%s: track is truncated\n", path);
+		track_close(t);
+		return false;
+	}
+	// juno_speak_segment indexes tables by the source
+	for (i = 0; i < nslices; ++i) {
+		if (slices[i].source >= SOURCE_LAST) {
+			fprintf(stderr, "%s: slice %zu has an unknown source %d\n",
+			        path, i, slices[i].source);
+			track_close(t);
+			return false;
+		}
+	}
+	t->header = h;
+	t->slices = slices;
+	t->nslices = nslices;
+	return true;
+}
+
+void track_close(struct track *t)
+{
+	if (t->map)
+		munmap(t->map, t->maplen);
+	memset(t, 0, sizeof *t);
+}
+
+static bool same_freqs(const FreqSet *a, const FreqSet *b)
+{
+	return memcmp(a->f, b->f, sizeof a->f) == 0;
+}
+
+void track_play(struct juno *juno, const struct track *t)
+{
+	track_play_scaled(juno, t, 0, 100);
+}
+
+bool track_play_scaled(struct juno *juno, const struct track *t,
+                       int pitch, int duration)
+{
+	// as juno_set_pitch (juno_pitch_ratio shifts by the octaves)
+	if (pitch < -JUNO_PITCH_RANGE || pitch > JUNO_PITCH_RANGE)
+		return false;
+
+	// pitch ratio and input slices per output slice, in 16.16 fixed point
+	unsigned long ratio = juno_pitch_ratio(pitch);
+	uint32_t nout = duration > 0 ?
+	                ((uint64_t)t->nslices * duration + 50) / 100 : 0;
+	uint64_t step = nout ? ((uint64_t)t->nslices << 16) / nout : 0;
+
+	// runs of identical slices are rendered as one steady segment, which
+	// renders the same samples as the slices one at a time
+	FreqSet run;
+	SoundSource runsource = SOURCE_SILENCE;
+	int runlen = 0;
+
+	uint32_t j;
+	for (j = 0; j < nout; ++j) {
+		uint64_t x = j * step;
+		uint32_t k = x >> 16;
+		long frac = x & 0xffff;
+		const struct track_slice *a = &t->slices[k];
+		const struct track_slice *b =
+			k + 1 < t->nslices ? &t->slices[k + 1] : a;
+		FreqSet f;
+		int i;
+
+		for (i = 0; i < N_FREQ; ++i) {
+			long fa = a->f[i], fb = b->f[i];
+			// interpolate only within a source, and never to or
+			// from an unused frequency
+			if (frac && a->source == b->source && fa && fb)
+				fa += (fb - fa) * frac / 65536;
+			f.f[i] = fa;
+		}
+		unsigned long f0 = (unsigned long)f.f[0] * ratio >> 16;
+		f.f[0] = f0 < 0x7fff ? f0 : 0x7fff;
+
+		if (runlen && (runlen == 0x7fff || a->source != runsource ||
+		               !same_freqs(&f, &run))) {
+			juno_speak_segment(juno, &run, &run, runlen, runsource);
+			runlen = 0;
+		}
+		if (runlen == 0) {
+			run = f;
+			runsource = a->source;
+		}
+		++runlen;
+	}
+	if (runlen)
+		juno_speak_segment(juno, &run, &run, runlen, runsource);
+	return true;
+}
@@ -0,0 +1,117 @@
+#ifndef _TRACK_H_
+#define _TRACK_H_
+
+/*
+ * Parameter tracks
+ *
+ * A parameter track is what juno_speak_segment renders, one record per
+ * timeslice: the sound source and the frequencies. Recording a prompt once
+ * and replaying the track skips the text and diphone stages entirely, and
+ * gives the renderer exactly the same input every time (for A/B benchmarks).
+ *
+ * File format (native byte order; the version field doubles as a byte order
+ * check):
+ *
+ *	struct track_header
+ *	struct track_slice[nslices]
+ *
+ * nslices is 0 if the track was written to a file that could not be
+ * rewound, in which case the slices run to the end of the file.
+ *
+ * Tracks are only supported on big targets.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "juno.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TRACK_MAGIC "JTRK"
+#define TRACK_VERSION 2
+
+struct track_header {
+	char magic[4];
+	uint16_t version;
+	uint16_t header_size; // sizeof(struct track_header)
+	uint32_t sample_rate;
+	uint16_t slices_per_second;
+	uint8_t n_freq; // N_FREQ
+	uint8_t voice; // index into voices[], or TRACK_OTHER_VOICE
+	uint32_t nslices;
+	// name of the voice (eg, of its voice file), NUL-padded, if known
+	char voice_name[16];
+};
+
+#define TRACK_OTHER_VOICE 0xff
+
+struct track_slice {
+	int16_t f[N_FREQ]; // accumulator units, as in FreqSet
+	uint8_t source; // SoundSource
+	uint8_t reserved;
+};
+
+/*
+ * Recording
+ *
+ * track_record_begin writes a header to f, then track_record can be given to
+ * juno_set_recorder with the recorder as its ctx. track_record_end writes the
+ * final slice count into the header. f is not closed.
+ *
+ * voice is the index of the voice in voices[] (see juno_get_voice), or -1 for
+ * a voice set some other way, and name is its name, or NULL. A track holds
+ * one frequency set per timeslice, so track_record_begin prints a message and
+ * returns false if FREQ_SUBSLICES is more than 1 (the replay would not be
+ * faithful).
+ */
+struct track_recorder {
+	FILE *f;
+	uint32_t nslices;
+	bool error;
+};
+
+bool track_record_begin(struct track_recorder *rec, FILE *f, int voice,
+                        const char *name);
+void track_record(void *rec, SoundSource source, const FreqSet *freqs,
+                  int nslices);
+bool track_record_end(struct track_recorder *rec);
+
+/*
+ * Replay
+ *
+ * track_open maps a track file into memory and checks its header and the
+ * sound source of every slice; it prints a message and returns false if the
+ * file is not a track that this build can play. track_play feeds every slice
+ * to juno_speak_segment.
+ *
+ * track_play_scaled re-renders a track at another pitch and speed without
+ * going back through the diphone stage, so it costs only kernel time. pitch
+ * shifts f0 (and with it the recorded pitch modulation) by a number of
+ * half-tones. duration is the length of the output as a percentage of the
+ * recording; the slices are resampled, interpolating the frequencies
+ * between neighbouring slices with the same source.
+ */
+struct track {
+	const struct track_header *header;
+	const struct track_slice *slices;
+	uint32_t nslices;
+
+	void *map;
+	size_t maplen;
+};
+
+bool track_open(struct track *t, const char *path);
+void track_close(struct track *t);
+void track_play(struct juno *juno, const struct track *t);
+// return false (and play nothing) if pitch is beyond JUNO_PITCH_RANGE
+bool track_play_scaled(struct juno *juno, const struct track *t,
+                       int pitch, int duration);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
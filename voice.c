@@ -7,3 +7,4 @@ extern Voice voiceBob;
 const Voice *voices[] = {
 	&voiceBob,
 };
+const int n_voices = sizeof voices / sizeof *voices;
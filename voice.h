@@ -3,10 +3,26 @@
 
 #include "phonemes.h"
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// the pitch of a voice is modulated over a cycle of diphones, by these ratios
+// to its pitch (scaled by 256)
+#define PITCH_MODULATION_CYCLE 16
+#define PITCH_MODULATION_RATIOS { \
+	120*256L/120, 128*256L/120, 134*256L/120, 138*256L/120, \
+	140*256L/120, 138*256L/120, 134*256L/120, 128*256L/120, \
+	120*256L/120, 112*256L/120, 106*256L/120, 102*256L/120, \
+	100*256L/120, 102*256L/120, 106*256L/120, 112*256L/120, \
+}
+
 typedef struct {
 	// default pitch and rate of this voice
 	int pitch;
 	int rate;
+	// pitch modulated by PITCH_MODULATION_RATIOS (precomputed by voicec)
+	unsigned short modulated_pitch[PITCH_MODULATION_CYCLE];
 
 	// XXX should I put buzz wavetables here? Those are probably different
 	// for each voice
@@ -14,6 +30,12 @@ typedef struct {
 	const Phoneme phonemes[N_PHONEME];
 } Voice;
 
+// voices[0] is the default voice
 extern const Voice *voices[];
+extern const int n_voices;
+
+#ifdef __cplusplus
+}
+#endif
 
 #endif
@@ -0,0 +1,402 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+
+// voice compiler (this runs only on a "big" target)
+//
+// usage: voicec description rate/slices...
+//
+// Reads a voice description (eg, voices/bob.txt) and writes the voice as C
+// for each sample rate and slice rate given, eg 16000/250. The frequencies
+// and durations are converted to accumulator units and timeslices here, as
+// F() and D() would, and the pitch modulation table of the voice is
+// precomputed, so the program needs none of that at run time. The tables for
+// each rate are compiled only if they match SAMPLE_RATE and
+// SLICES_PER_SECOND.
+//
+// A description is a list of lines; # starts a comment:
+//
+// voice <name>			C name is voice<name>
+// pitch <Hz>
+// rate <words per minute>
+// type <type> <glide> <obstruent> <buzz> <presrc> <nsrc> <postsrc>
+//      <nucleus ms> <transition ms>
+//				flags of a phoneme type (phonemeFlags)
+// phoneme <name> <type> [<obstype>]
+//				a phoneme (P_<name>), followed by its F0..F3 in
+//				Hz on lines of their own:
+//	f <F0> <F1> <F2> <F3>	nucleus
+//	<obstype> <F0> <F1> <F2> <F3>
+//				obstruent target
+//
+// Types, buzz types, sources, and obstruent types are the names of the enums
+// in phonemes.h in lower case, without their prefixes (eg, vowel, nasal,
+// frication, velar). Every phoneme must be described. Type lines are
+// optional, but phonemeFlags is shared by all voices, so only one voice
+// linked into a program may have them.
+
+#include "juno.h"
+#include "phonemes.h"
+#include "voice.h"
+
+struct name {
+	const char *name; // in descriptions
+	const char *cname;
+};
+
+#define NAME(prefix, n, s) [prefix##n] = { s, #prefix #n }
+
+static const struct name type_names[PHONEME_TYPE_COUNT] = {
+	NAME(PHONEME_TYPE_, SILENCE, "silence"),
+	NAME(PHONEME_TYPE_, PLOSIVE, "plosive"),
+	NAME(PHONEME_TYPE_, VPLOSIVE, "vplosive"),
+	NAME(PHONEME_TYPE_, FRICATIVE, "fricative"),
+	NAME(PHONEME_TYPE_, ASPIRATED, "aspirated"),
+	NAME(PHONEME_TYPE_, VOWEL, "vowel"),
+	NAME(PHONEME_TYPE_, SEMIVOWEL, "semivowel"),
+	NAME(PHONEME_TYPE_, NASAL, "nasal"),
+	NAME(PHONEME_TYPE_, LIQUID, "liquid"),
+};
+
+static const struct name buzz_names[] = {
+	NAME(BUZZ_, VOWEL, "vowel"),
+	NAME(BUZZ_, LIQUID, "liquid"),
+	NAME(BUZZ_, PLOSIVE, "plosive"),
+	NAME(BUZZ_, NASAL, "nasal"),
+};
+
+static const struct name source_names[SOURCE_LAST] = {
+	NAME(SOURCE_, SILENCE, "silence"),
+	NAME(SOURCE_, ASPIRATION, "aspiration"),
+	NAME(SOURCE_, FRICATION, "frication"),
+	NAME(SOURCE_, BUZZ, "buzz"),
+};
+
+static const struct name obs_names[N_OBS] = {
+	NAME(OBS_, LABIAL, "labial"),
+	NAME(OBS_, ALVEOLAR, "alveolar"),
+	NAME(OBS_, VELAR, "velar"),
+};
+
+#define PNAME(n) [P_##n] = { #n, "P_" #n }
+static const struct name phoneme_names[N_PHONEME] = {
+	PNAME(none),
+	PNAME(j), PNAME(w), PNAME(i), PNAME(u), PNAME(I), PNAME(U),
+	PNAME(e), PNAME(o), PNAME(V), PNAME(SCHWA), PNAME(R),
+	PNAME(E), PNAME(O), PNAME(ae), PNAME(a), PNAME(A),
+	PNAME(l), PNAME(r),
+	PNAME(m), PNAME(n), PNAME(N),
+	PNAME(b), PNAME(p), PNAME(d), PNAME(t), PNAME(g), PNAME(k),
+	PNAME(f), PNAME(v), PNAME(s), PNAME(z),
+	PNAME(S), PNAME(Z), PNAME(T), PNAME(D),
+	PNAME(h),
+};
+
+#define N_NAMES(a) (sizeof (a) / sizeof *(a))
+
+// the voice as described, in Hz and ms
+static struct {
+	char name[32];
+	double pitch;
+	int rate;
+
+	bool have_types;
+	struct {
+		bool described;
+		int glide, obstruent, buzz, presrc, nsrc, postsrc;
+		double ndur, tdur;
+	} types[PHONEME_TYPE_COUNT];
+
+	struct {
+		bool described;
+		int type, obstype;
+		double f[N_FREQ];
+		bool have_obstarget[N_OBS];
+		double obstargets[N_OBS][N_FREQ];
+	} phonemes[N_PHONEME];
+} voice;
+
+static const char *path;
+static int lineno;
+
+static void error(const char *fmt, ...)
+{
+	va_list ap;
+	va_start(ap, fmt);
+	fprintf(stderr, "%s:%d: ", path, lineno);
+	vfprintf(stderr, fmt, ap);
+	fprintf(stderr, "\n");
+	va_end(ap);
+	exit(1);
+}
+
+// next word of the line being parsed, or NULL at the end
+static const char *word(void)
+{
+	return strtok(NULL, " \t\n");
+}
+
+static const char *need_word(const char *what)
+{
+	const char *w = word();
+	if (!w)
+		error("missing %s", what);
+	return w;
+}
+
+static int lookup(const struct name *names, int n, const char *what)
+{
+	const char *w = need_word(what);
+	int i;
+	for (i = 0; i < n; ++i) {
+		if (names[i].name && strcmp(names[i].name, w) == 0)
+			return i;
+	}
+	error("unknown %s %s", what, w);
+	return -1;
+}
+
+static double number(const char *what)
+{
+	const char *w = need_word(what);
+	char *end;
+	double x = strtod(w, &end);
+	if (*end || x < 0)
+		error("bad %s %s", what, w);
+	return x;
+}
+
+static void freqs(double f[N_FREQ])
+{
+	int i;
+	for (i = 0; i < N_FREQ; ++i)
+		f[i] = number("frequency");
+}
+
+static void parse(FILE *in)
+{
+	char line[256];
+	int p = -1; // phoneme being described
+	int i;
+
+	while (fgets(line, sizeof line, in)) {
+		++lineno;
+		char *hash = strchr(line, '#');
+		if (hash)
+			*hash = '\0';
+		const char *key = strtok(line, " \t\n");
+		if (!key)
+			continue;
+
+		if (strcmp(key, "voice") == 0) {
+			snprintf(voice.name, sizeof voice.name, "%s",
+			         need_word("name"));
+		} else if (strcmp(key, "pitch") == 0) {
+			voice.pitch = number("pitch");
+		} else if (strcmp(key, "rate") == 0) {
+			voice.rate = number("rate");
+		} else if (strcmp(key, "type") == 0) {
+			int t = lookup(type_names, N_NAMES(type_names), "type");
+			voice.have_types = true;
+			voice.types[t].described = true;
+			voice.types[t].glide = number("glide") != 0;
+			voice.types[t].obstruent = number("obstruent") != 0;
+			voice.types[t].buzz = lookup(buzz_names,
+				N_NAMES(buzz_names), "buzz type");
+			voice.types[t].presrc = lookup(source_names,
+				N_NAMES(source_names), "source");
+			voice.types[t].nsrc = lookup(source_names,
+				N_NAMES(source_names), "source");
+			voice.types[t].postsrc = lookup(source_names,
+				N_NAMES(source_names), "source");
+			voice.types[t].ndur = number("duration");
+			voice.types[t].tdur = number("duration");
+		} else if (strcmp(key, "phoneme") == 0) {
+			p = lookup(phoneme_names, N_NAMES(phoneme_names),
+			           "phoneme");
+			if (voice.phonemes[p].described)
+				error("phoneme %s described twice",
+				      phoneme_names[p].name);
+			voice.phonemes[p].described = true;
+			voice.phonemes[p].type = lookup(type_names,
+				N_NAMES(type_names), "type");
+			// obstruent type is optional
+			const char *w = word();
+			for (i = 0; w && i < N_OBS; ++i) {
+				if (strcmp(obs_names[i].name, w) == 0)
+					break;
+			}
+			if (w && i == N_OBS)
+				error("unknown obstruent type %s", w);
+			voice.phonemes[p].obstype = w ? i : 0;
+		} else if (p >= 0 && strcmp(key, "f") == 0) {
+			freqs(voice.phonemes[p].f);
+		} else if (p >= 0) {
+			for (i = 0; i < N_OBS; ++i) {
+				if (strcmp(obs_names[i].name, key) == 0)
+					break;
+			}
+			if (i == N_OBS)
+				error("unknown keyword %s", key);
+			voice.phonemes[p].have_obstarget[i] = true;
+			freqs(voice.phonemes[p].obstargets[i]);
+		} else {
+			error("unknown keyword %s", key);
+		}
+		if (word())
+			error("too many fields");
+	}
+
+	lineno = 0;
+	if (!voice.name[0])
+		error("voice has no name");
+	if (voice.pitch == 0)
+		error("voice has no pitch");
+	if (voice.rate == 0)
+		error("voice has no rate");
+	for (i = 0; i < N_PHONEME; ++i) {
+		if (!voice.phonemes[i].described)
+			error("phoneme %s is not described",
+			      phoneme_names[i].name);
+	}
+	for (i = 0; voice.have_types && i < PHONEME_TYPE_COUNT; ++i) {
+		if (!voice.types[i].described)
+			error("type %s is not described", type_names[i].name);
+	}
+}
+
+// as F(hz) and D(ms) for sample rate rate and slice rate slices
+static long rate, slices;
+
+static short freq(double hz)
+{
+	double f = hz * 65536 / rate;
+	if (f >= 32768) {
+		fprintf(stderr, "%s: %g Hz does not fit at %ld Hz\n",
+		        path, hz, rate);
+		exit(1);
+	}
+	return f;
+}
+
+static short dur(double ms)
+{
+	return ms * slices / 1000;
+}
+
+static void print_freqs(const double f[N_FREQ])
+{
+	int i;
+	printf("{ .f = {");
+	for (i = 0; i < N_FREQ; ++i)
+		printf(" %d%s", freq(f[i]), i < N_FREQ - 1 ? "," : "");
+	printf(" }, }");
+}
+
+static void print_voice(bool first)
+{
+	static const unsigned short ratios[PITCH_MODULATION_CYCLE] =
+		PITCH_MODULATION_RATIOS;
+	int pitch = freq(voice.pitch);
+	int p, i;
+
+	printf("#%s SAMPLE_RATE == %ld && SLICES_PER_SECOND == %ld\n\n",
+	       first ? "if" : "elif", rate, slices);
+
+	if (voice.have_types) {
+		printf("const PhonemeFlags phonemeFlags[PHONEME_TYPE_COUNT] "
+		       "PROGMEM = {\n");
+		for (i = 0; i < PHONEME_TYPE_COUNT; ++i) {
+			const typeof(voice.types[0]) *t = &voice.types[i];
+			printf("\t[%s] = {\n", type_names[i].cname);
+			printf("\t\t.glide = %d,\n", t->glide);
+			printf("\t\t.obstruent = %d,\n", t->obstruent);
+			printf("\t\t.buzz = %s,\n", buzz_names[t->buzz].cname);
+			printf("\t\t.presrc = %s,\n",
+			       source_names[t->presrc].cname);
+			printf("\t\t.nsrc = %s,\n", source_names[t->nsrc].cname);
+			printf("\t\t.postsrc = %s,\n",
+			       source_names[t->postsrc].cname);
+			printf("\t\t.ndur = %d, // %g ms\n", dur(t->ndur),
+			       t->ndur);
+			printf("\t\t.tdur = %d, // %g ms\n", dur(t->tdur),
+			       t->tdur);
+			printf("\t},\n");
+		}
+		printf("};\n\n");
+	}
+
+	printf("const Voice voice%s PROGMEM = {\n", voice.name);
+	printf("\t.pitch = %d, // %g Hz\n", pitch, voice.pitch);
+	printf("\t.rate = %d,\n", voice.rate);
+	printf("\t.modulated_pitch = {");
+	for (i = 0; i < PITCH_MODULATION_CYCLE; ++i) {
+		printf("%s%u,", i % 8 ? " " : "\n\t\t",
+		       (unsigned short)(ratios[i] * (unsigned long)pitch / 256));
+	}
+	printf("\n\t},\n");
+	printf("\t.phonemes = {\n");
+	for (p = 0; p < N_PHONEME; ++p) {
+		const typeof(voice.phonemes[0]) *ph = &voice.phonemes[p];
+		printf("\t\t[%s] = {\n", phoneme_names[p].cname);
+		printf("\t\t\t.type = %s,\n", type_names[ph->type].cname);
+		printf("\t\t\t.obstype = %s,\n", obs_names[ph->obstype].cname);
+		printf("\t\t\t.f = ");
+		print_freqs(ph->f);
+		printf(",\n");
+		for (i = 0; i < N_OBS; ++i) {
+			if (!ph->have_obstarget[i])
+				continue;
+			printf("\t\t\t.obstargets[%s] = ", obs_names[i].cname);
+			print_freqs(ph->obstargets[i]);
+			printf(",\n");
+		}
+		printf("\t\t},\n");
+	}
+	printf("\t},\n};\n\n");
+}
+
+int main(int argc, char *argv[])
+{
+	FILE *in;
+	int i;
+
+	if (argc < 3) {
+		fprintf(stderr, "usage: %s description rate/slices...\n",
+		        argv[0]);
+		return 1;
+	}
+	path = argv[1];
+	in = fopen(path, "r");
+	if (!in) {
+		perror(path);
+		return 1;
+	}
+	parse(in);
+	fclose(in);
+
+	printf("/* THIS FILE IS AUTO-GENERATED! DO NOT EDIT THIS FILE. */\n"
+	       "/* voicec");
+	for (i = 1; i < argc; ++i)
+		printf(" %s", argv[i]);
+	printf(" */\n\n"
+	       "#include <stdbool.h>\n\n"
+	       "#include \"juno.h\"\n"
+	       "#include \"phonemes.h\"\n"
+	       "#include \"voice.h\"\n\n");
+	for (i = 2; i < argc; ++i) {
+		if (sscanf(argv[i], "%ld/%ld", &rate, &slices) != 2 ||
+		    rate <= 0 || slices <= 0) {
+			fprintf(stderr, "bad rate %s (want eg 16000/250)\n",
+			        argv[i]);
+			return 1;
+		}
+		print_voice(i == 2);
+	}
+	printf("#else\n"
+	       "#error no tables for this SAMPLE_RATE and SLICES_PER_SECOND "
+	       "(add them with voicec)\n"
+	       "#endif\n");
+	return 0;
+}
@@ -0,0 +1,266 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "juno.h"
+#include "packed.h"
+#include "voicefile.h"
+
+// CRC-32 (as in zlib), a bit at a time; a voice is less than a page
+static uint32_t crc32(const void *data, size_t n)
+{
+	const uint8_t *p = data;
+	uint32_t crc = 0xffffffff;
+	int i;
+	while (n--) {
+		crc ^= *p++;
+		for (i = 0; i < 8; ++i)
+			crc = crc >> 1 ^ (0xedb88320 & -(crc & 1));
+	}
+	return ~crc;
+}
+
+bool voice_file_write(FILE *f, const PackedVoice *v, const char *name)
+{
+	struct voice_file_header h = {
+		.magic = VOICE_FILE_MAGIC,
+		.version = VOICE_FILE_VERSION,
+		.header_size = sizeof h,
+		.sample_rate = SAMPLE_RATE,
+		.slices_per_second = SLICES_PER_SECOND,
+		.n_freq = N_FREQ,
+		.n_phoneme = N_PHONEME,
+		.n_phoneme_type = PHONEME_TYPE_COUNT,
+		.n_obs = N_OBS,
+		.size = sizeof *v,
+		.checksum = crc32(v, sizeof *v),
+	};
+	// NUL-padded, and always NUL-terminated
+	memcpy(h.name, name, strnlen(name, sizeof h.name - 1));
+	return fwrite(&h, sizeof h, 1, f) == 1 && fwrite(v, sizeof *v, 1, f) == 1;
+}
+
+// the payload follows the header in place, so it must stay aligned
+#define VOICE_ALIGN _Alignof(PackedVoice)
+
+struct juno_voice *juno_load_voice(const char *path)
+{
+	struct juno_voice *voice;
+	struct stat st;
+	int fd;
+
+	voice = calloc(1, sizeof *voice);
+	if (!voice) {
+		fprintf(stderr, "%s: %s\n", path, strerror(errno));
+		return NULL;
+	}
+	fd = open(path, O_RDONLY);
+	if (fd < 0 || fstat(fd, &st) < 0) {
+		fprintf(stderr, "%s: %s\n", path, strerror(errno));
+		if (fd >= 0)
+			close(fd);
+		free(voice);
+		return NULL;
+	}
+	if (st.st_size < sizeof *voice->header) {
+		fprintf(stderr, "%s: not a voice\n", path);
+		close(fd);
+		free(voice);
+		return NULL;
+	}
+	// shared, so that every process speaking with this voice uses the
+	// same pages of the page cache
+	voice->maplen = st.st_size;
+	voice->map = mmap(NULL, voice->maplen, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (voice->map == MAP_FAILED) {
+		fprintf(stderr, "%s: %s\n", path, strerror(errno));
+		free(voice);
+		return NULL;
+	}
+
+	const struct voice_file_header *h = voice->map;
+	const PackedVoice *v = (const void *)((const char *)voice->map +
+	                                      h->header_size);
+	const char *why = NULL;
+	if (memcmp(h->magic, VOICE_FILE_MAGIC, sizeof h->magic) != 0)
+		why = "not a voice";
+	else if (h->version != VOICE_FILE_VERSION ||
+	         h->header_size < sizeof *h || h->header_size % VOICE_ALIGN)
+		why = "unsupported voice version or byte order";
+	else if (h->n_freq != N_FREQ || h->n_phoneme != N_PHONEME ||
+	         h->n_phoneme_type != PHONEME_TYPE_COUNT || h->n_obs != N_OBS ||
+	         h->size != sizeof *v)
+		why = "voice has a different set of phonemes or formants";
+	else if (h->sample_rate != SAMPLE_RATE ||
+	         h->slices_per_second != SLICES_PER_SECOND)
+		why = "voice was built for a different sample or slice rate";
+	else if (h->header_size + (size_t)h->size > voice->maplen)
+		why = "voice is truncated";
+	else if (crc32(v, sizeof *v) != h->checksum)
+		why = "voice checksum does not match";
+	else if (!voice_packed_check(v))
+		why = "voice has no pitch or rate, or phoneme types out of range";
+	if (why) {
+		fprintf(stderr, "%s: %s\n", path, why);
+		juno_unload_voice(voice);
+		return NULL;
+	}
+
+	voice->header = h;
+	voice->voice = v;
+	return voice;
+}
+
+void juno_unload_voice(struct juno_voice *voice)
+{
+	if (!voice)
+		return;
+	if (voice->map)
+		munmap(voice->map, voice->maplen);
+	free(voice);
+}
+
+struct juno_voice_handle *juno_voice_handle_create(struct juno_voice *voice)
+{
+	struct juno_voice_handle *handle;
+	if (!voice)
+		return NULL;
+	handle = calloc(1, sizeof *handle);
+	if (!handle)
+		return NULL;
+	atomic_init(&handle->current, voice);
+	pthread_mutex_init(&handle->lock, NULL);
+	return handle;
+}
+
+void juno_voice_handle_destroy(struct juno_voice_handle *handle)
+{
+	int i;
+	if (!handle)
+		return;
+	for (i = 0; i < handle->nretired; ++i)
+		juno_unload_voice(handle->retired[i]);
+	juno_unload_voice(atomic_load(&handle->current));
+	pthread_mutex_destroy(&handle->lock);
+	free(handle->retired);
+	free(handle);
+}
+
+static bool voice_in_use(const struct juno_voice_handle *handle,
+                         const struct juno_voice *voice)
+{
+	const struct juno_voice_reader *r;
+	for (r = handle->readers; r; r = r->next) {
+		if (atomic_load(&r->hazard) == voice)
+			return true;
+	}
+	return false;
+}
+
+// unload retired voices that no hazard pointer holds (with the lock held)
+static int reclaim(struct juno_voice_handle *handle)
+{
+	int i, n = 0;
+	for (i = 0; i < handle->nretired; ++i) {
+		struct juno_voice *voice = handle->retired[i];
+		if (voice_in_use(handle, voice))
+			handle->retired[n++] = voice;
+		else
+			juno_unload_voice(voice);
+	}
+	handle->nretired = n;
+	return n;
+}
+
+bool juno_voice_publish(struct juno_voice_handle *handle,
+                        struct juno_voice *voice)
+{
+	if (!voice)
+		return false;
+	pthread_mutex_lock(&handle->lock);
+	if (handle->nretired == handle->maxretired) {
+		int max = handle->maxretired ? 2 * handle->maxretired : 4;
+		void *retired = realloc(handle->retired,
+		                        max * sizeof *handle->retired);
+		if (!retired) {
+			pthread_mutex_unlock(&handle->lock);
+			return false;
+		}
+		handle->retired = retired;
+		handle->maxretired = max;
+	}
+	// after the exchange, a reader can only take up the new voice, so
+	// the hazard pointers read by reclaim cover every use of the old one
+	handle->retired[handle->nretired++] =
+		atomic_exchange(&handle->current, voice);
+	reclaim(handle);
+	pthread_mutex_unlock(&handle->lock);
+	return true;
+}
+
+int juno_voice_reclaim(struct juno_voice_handle *handle)
+{
+	int n;
+	pthread_mutex_lock(&handle->lock);
+	n = reclaim(handle);
+	pthread_mutex_unlock(&handle->lock);
+	return n;
+}
+
+struct juno_voice *voice_reader_attach(struct juno_voice_reader *reader,
+                                       struct juno_voice_handle *handle)
+{
+	struct juno_voice_handle *old = reader->handle;
+	struct juno_voice_reader **rp;
+
+	if (old) {
+		pthread_mutex_lock(&old->lock);
+		for (rp = &old->readers; *rp != reader; rp = &(*rp)->next)
+			;
+		*rp = reader->next;
+		atomic_store(&reader->hazard, NULL);
+		reclaim(old);
+		pthread_mutex_unlock(&old->lock);
+	}
+	reader->handle = handle;
+	reader->voice = NULL;
+	reader->next = NULL;
+	if (!handle)
+		return NULL;
+
+	// the current voice cannot be retired while the lock is held
+	pthread_mutex_lock(&handle->lock);
+	reader->voice = atomic_load(&handle->current);
+	atomic_store(&reader->hazard, reader->voice);
+	reader->next = handle->readers;
+	handle->readers = reader;
+	pthread_mutex_unlock(&handle->lock);
+	return reader->voice;
+}
+
+struct juno_voice *voice_reader_update(struct juno_voice_reader *reader)
+{
+	struct juno_voice *voice =
+		atomic_load_explicit(&reader->handle->current,
+		                     memory_order_acquire);
+	if (voice == reader->voice)
+		return NULL;
+	// publish the hazard pointer before using the voice, then make sure
+	// the voice was not retired (and perhaps unloaded) in the meantime
+	for (;;) {
+		struct juno_voice *current;
+		atomic_store(&reader->hazard, voice);
+		current = atomic_load(&reader->handle->current);
+		if (current == voice)
+			break;
+		voice = current;
+	}
+	reader->voice = voice;
+	return voice;
+}
@@ -0,0 +1,165 @@
+#ifndef _VOICEFILE_H_
+#define _VOICEFILE_H_
+
+/*
+ * Voice files
+ *
+ * A voice file holds a packed voice (see packed.h): the phonemes, the flags
+ * of every phoneme type, and the default pitch and rate. juno_load_voice maps
+ * it into memory read-only and shared, and the juno objects speak from the
+ * mapping directly (zero-copy), so every process that loads the same file
+ * shares the same physical pages. Voices can be added without rebuilding.
+ *
+ * File format (native byte order; the version field doubles as a byte order
+ * check):
+ *
+ *	struct voice_file_header
+ *	PackedVoice
+ *
+ * Frequencies are in accumulator units and durations are in timeslices, so a
+ * voice file only fits builds with the same SAMPLE_RATE and
+ * SLICES_PER_SECOND; the header records both. checksum is the CRC-32 of the
+ * PackedVoice.
+ *
+ * A loaded voice file must not be rewritten in place (that changes the
+ * mapping under the juno objects). Write a new file and rename it over the
+ * old one instead.
+ *
+ * Voice files are only supported on big targets.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <pthread.h>
+#ifndef __cplusplus
+# include <stdatomic.h>
+#endif
+
+#include "juno.h"
+#include "packed.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define VOICE_FILE_MAGIC "JVOX"
+#define VOICE_FILE_VERSION 1
+
+struct voice_file_header {
+	char magic[4];
+	uint16_t version;
+	uint16_t header_size; // sizeof(struct voice_file_header)
+	uint32_t sample_rate;
+	uint16_t slices_per_second;
+	// layout of the PackedVoice
+	uint8_t n_freq; // N_FREQ
+	uint8_t n_phoneme; // N_PHONEME
+	uint8_t n_phoneme_type; // PHONEME_TYPE_COUNT
+	uint8_t n_obs; // N_OBS
+	uint16_t reserved;
+	uint32_t size; // sizeof(PackedVoice)
+	uint32_t checksum;
+	char name[16]; // NUL-padded (so at most 15 characters)
+};
+
+// write packed voice v to f as a voice file named name
+bool voice_file_write(FILE *f, const PackedVoice *v, const char *name);
+
+/*
+ * Loading
+ *
+ * juno_load_voice maps a voice file and checks its header, checksum, and
+ * phoneme types. It prints a message and returns NULL if the file is not a
+ * voice that this build can speak with. Give voice->voice to
+ * juno_set_packed_voice. juno_unload_voice unmaps the file, so no juno object
+ * may be speaking with it any more.
+ */
+struct juno_voice {
+	const struct voice_file_header *header;
+	const PackedVoice *voice;
+
+	void *map;
+	size_t maplen;
+};
+
+struct juno_voice *juno_load_voice(const char *path);
+void juno_unload_voice(struct juno_voice *voice);
+
+/*
+ * Hot swapping
+ *
+ * A voice handle lets a voice be replaced while juno objects are speaking
+ * with it, RCU style. juno_voice_publish makes a new voice current, and every
+ * juno object attached to the handle (juno_attach_voice) switches to it at
+ * its next diphone boundary. The old voice is retired, and unloaded once no
+ * juno object is still speaking with it.
+ *
+ * Rendering never takes a lock: at a diphone boundary, a juno object checks
+ * the current voice of its handle with an atomic load. To switch, it stores
+ * the new voice in its hazard pointer and checks again that the voice is
+ * still current; the publisher only unloads retired voices that no hazard
+ * pointer holds. A juno object needs the voice only while it plans a diphone
+ * (the segments it queues are copies), so one hazard pointer per object is
+ * enough.
+ *
+ * Publishing, attaching, and detaching take the handle's mutex. Retired
+ * voices are checked again at every publish and detach, and by
+ * juno_voice_reclaim, which a control thread can call after sessions have
+ * moved on.
+ *
+ * The handle and reader are C11 atomics, which C++ cannot share, so C++ only
+ * sees the handle as an opaque type.
+ */
+#ifndef __cplusplus
+struct juno_voice_reader {
+	struct juno_voice_handle *handle; // NULL if not attached
+	struct juno_voice *voice; // voice in use
+	_Atomic(struct juno_voice *) hazard;
+	struct juno_voice_reader *next; // in handle->readers
+};
+
+struct juno_voice_handle {
+	_Atomic(struct juno_voice *) current;
+	pthread_mutex_t lock;
+	// attached juno objects, and voices waiting to be unloaded
+	struct juno_voice_reader *readers;
+	struct juno_voice **retired;
+	int nretired, maxretired;
+};
+#else
+struct juno_voice_handle;
+#endif
+
+// the handle takes over voice (and every voice published to it)
+// voice may come straight from juno_load_voice: if it is NULL, so is the handle
+struct juno_voice_handle *juno_voice_handle_create(struct juno_voice *voice);
+// unload every voice; no juno object may be attached any more
+void juno_voice_handle_destroy(struct juno_voice_handle *handle);
+// make voice current and retire the old one
+// return false (and leave the handle unchanged) if voice is NULL or out of
+// memory
+bool juno_voice_publish(struct juno_voice_handle *handle,
+                        struct juno_voice *voice);
+// unload retired voices no longer in use, and return how many are left
+int juno_voice_reclaim(struct juno_voice_handle *handle);
+
+// speak with the current voice of handle, following it as it changes
+// NULL detaches, and goes back to the default voice, as does setting a voice
+// with juno_set_voice or juno_set_packed_voice
+void juno_attach_voice(struct juno *juno, struct juno_voice_handle *handle);
+
+#ifndef __cplusplus
+// for juno.c: attach reader to handle (or detach it, if handle is NULL), and
+// return the current voice
+struct juno_voice *voice_reader_attach(struct juno_voice_reader *reader,
+                                       struct juno_voice_handle *handle);
+// at a diphone boundary: return the voice to switch to, or NULL if the
+// current voice has not changed
+struct juno_voice *voice_reader_update(struct juno_voice_reader *reader);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -3,12 +3,17 @@
 #include "juno.h"
 #include "wave.h"
 
+#if !BUZZ_MULTIPLY
 const wavetable_t sine_wavetables[BUZZ_WAVETABLE_SCALE] PROGMEM = {
 	{ {   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,} },
 	{ {   0,   1,   2,   2,   3,   4,   4,   5,   5,   5,   4,   4,   3,   2,   2,   1,   0,  -1,  -2,  -2,  -3,  -4,  -4,  -5,  -5,  -5,  -4,  -4,  -3,  -2,  -2,  -1,} },
 	{ {   0,   2,   4,   5,   7,   8,   9,  10,  10,  10,   9,   8,   7,   5,   4,   2,   0,  -2,  -4,  -5,  -7,  -8,  -9, -10, -10, -10,  -9,  -8,  -7,  -5,  -4,  -2,} },
 	{ {   0,   3,   6,   8,  11,  13,  14,  15,  15,  15,  14,  13,  11,   8,   6,   3,   0,  -3,  -6,  -8, -11, -13, -14, -15, -15, -15, -14, -13, -11,  -8,  -6,  -3,} },
 };
+#else
+const wavetable_t sine_wavetable PROGMEM = { {   0,  24,  48,  70,  89, 105, 117, 124, 127, 124, 117, 105,  89,  70,  48,  24,   0, -24, -48, -70, -89,-105,-117,-124,-127,-124,-117,-105, -89, -70, -48, -24,} };
+#endif
+#if !FRIC_NOISE_LFSR
 const fric_wavetable_t frication_wavetable PROGMEM = { {  0x00, 0x03, 0x02, 0x02, 0xff, 0xfe, 0xff, 0xff, 0xff, 0x00, 0x02, 0x05,
   0x03, 0x01, 0xfe, 0xfa, 0xfa, 0xfe, 0x05, 0x06, 0x05, 0x00, 0xfc, 0xfc,
   0xfd, 0x00, 0x03, 0x03, 0x01, 0xfe, 0xfd, 0xfe, 0x00, 0x04, 0x05, 0x00,
@@ -353,6 +358,27 @@ const fric_wavetable_t soft_frication_wavetable PROGMEM = { {  0x00, 0x00, 0x01,
   0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xff, 0xff,
   0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0x00, 0x00
 } };
+#endif
+#if ENVELOPE_RECIP || FREQ_DDA
+const unsigned short recip_table[RECIP_MIN] PROGMEM = {
+	512,508,504,500,496,492,489,485,
+	481,478,474,471,468,464,461,458,
+	455,451,448,445,442,439,436,434,
+	431,428,425,422,420,417,414,412,
+	409,407,404,402,399,397,394,392,
+	390,387,385,383,381,378,376,374,
+	372,370,368,366,364,362,360,358,
+	356,354,352,350,348,346,344,343,
+	341,339,337,336,334,332,330,329,
+	327,326,324,322,321,319,318,316,
+	315,313,312,310,309,307,306,304,
+	303,302,300,299,297,296,295,293,
+	292,291,289,288,287,286,284,283,
+	282,281,280,278,277,276,275,274,
+	273,271,270,269,268,267,266,265,
+	264,263,262,261,260,259,258,257,
+};
+#endif
 const wavetable_t vowel_buzz PROGMEM = { {   0,   3,   6,   7,   8,   9,   9,   9,   9,   8,   7,   6,   5,   4,   2,   1,   0,  -1,  -2,  -4,  -5,  -6,  -7,  -8,  -9,  -9,  -9,  -9,  -8,  -7,  -6,  -3,} };
 const wavetable_t nasal_buzz PROGMEM = { {   0,   5,   7,   9,   9,  10,   9,   9,   9,   8,   7,   6,   5,   3,   2,   1,   0,  -1,  -2,  -3,  -5,  -6,  -7,  -8,  -9,  -9,  -9, -10,  -9,  -9,  -7,  -5,} };
 const wavetable_t frication_buzz PROGMEM = { {   0,   5,   7,   9,   9,  10,   9,   9,   9,   8,   7,   6,   5,   3,   2,   1,   0,  -1,  -2,  -3,  -5,  -6,  -7,  -8,  -9,  -9,  -9, -10,  -9,  -9,  -7,  -5,} };
@@ -11,6 +11,38 @@
 // 0.125 of the full scale wave (there is one waveform reserved with zero
 // amplitude).
 #define BUZZ_WAVETABLE_SCALE 4
+
+/*
+ * BUZZ_MULTIPLY selects how the amplitudes of the harmonics are set.
+ *
+ * In table mode (0), there are BUZZ_WAVETABLE_SCALE pre-scaled copies of the
+ * sine wavetable and each oscillator points at the copy with the amplitude it
+ * wants. That costs nothing per sample but only gives 4 amplitude levels.
+ *
+ * In multiply mode (1), there is a single full-scale sine wavetable and each
+ * oscillator has a gain of 0..SINE_GAIN_MAX. Each sample is multiplied by the
+ * gain and shifted right 8 bits, which is just the high byte of an 8x8
+ * multiply on AVR. The glottal buzz (oscillator 0) is never scaled.
+ *
+ * Multiply mode is the default on targets with a hardware multiplier.
+ */
+#ifndef BUZZ_MULTIPLY
+# if BIG_TARGET || defined(__AVR_HAVE_MUL__)
+#  define BUZZ_MULTIPLY 1
+# else
+#  define BUZZ_MULTIPLY 0
+# endif
+#endif
+
+// SINE_GAIN_MAX scales the full-scale sine to the same peak as the loudest
+// table-mode sine (1/8 of full scale)
+#define SINE_GAIN_MAX 32
+
+#if BUZZ_MULTIPLY
+# define N_SINE_WAVE 1
+#else
+# define N_SINE_WAVE BUZZ_WAVETABLE_SCALE
+#endif
 //10 (1024) for frication
 //#define LOG2_WAVEFORM_SIZE 10
 // 5 is a good size for periodic waveforms
@@ -20,6 +52,27 @@
 #define LOG2_FRIC_WAVETABLE_SIZE 11 // total size of frication wavetable
 #define LOG2_FRIC_WAVETABLE_PERIOD 3 // length of 1 cycle
 
+/*
+ * FRIC_NOISE_LFSR replaces the frication wavetable with procedural noise.
+ *
+ * The frication wavetable is noise bandpassed to a narrow band around one
+ * cycle per FRIC_WAVETABLE_PERIOD samples, ie, a sine at the oscillator
+ * frequency whose amplitude wanders at random. The procedural oscillator
+ * makes that directly: an 8-step sine carrier whose amplitude is set once per
+ * cycle from a 16-bit xorshift generator, smoothed by averaging it with the
+ * previous amplitude (a one-tap filter). It needs 3 bytes of state per
+ * oscillator and an 8-byte carrier table instead of the 2 KB wavetable, and
+ * costs one multiply per sample plus a generator step once per cycle.
+ *
+ * It is off by default: on the host it is about 1.6 times slower per sample
+ * than the wavetable, and it has not been timed on AVR. Turn it on to trade
+ * render time for flash on small targets, where the wavetable takes a big
+ * piece of it.
+ */
+#ifndef FRIC_NOISE_LFSR
+# define FRIC_NOISE_LFSR 0
+#endif
+
 // shift phase accumulator right by LOG2_PHASE_MODULUS-*_PERIOD bits
 // mask lowest *_SIZE bits
 
@@ -131,8 +184,28 @@ typedef struct {
 // divided by a constant factor as periodic waves are.
 
 extern const wavetable_t sine_wavetables[BUZZ_WAVETABLE_SCALE];
+extern const wavetable_t sine_wavetable;
 extern const fric_wavetable_t frication_wavetable;
 extern const fric_wavetable_t aspiration_wavetable;
 extern const wavetable_t vowel_buzz, nasal_buzz, liquid_buzz, frication_buzz;
 
+// indices of the periodic wavetables in buzz_wavetables[]
+// in table mode, WAVE_SINE+n is the sine wavetable with amplitude n
+// in multiply mode, WAVE_SINE is the full-scale sine wavetable
+enum {
+	WAVE_SINE = 0,
+	WAVE_VOWEL_BUZZ = WAVE_SINE + N_SINE_WAVE,
+	WAVE_NASAL_BUZZ,
+	WAVE_FRICATION_BUZZ,
+	N_WAVE,
+};
+
+extern const wavetable_t *const buzz_wavetables[N_WAVE];
+
+// recip_table[m-RECIP_MIN] is 65536/m for RECIP_MIN <= m < 2*RECIP_MIN
+// (used by calc_envelope when ENVELOPE_RECIP is set and by
+// juno_speak_segment when FREQ_DDA is set)
+#define RECIP_MIN 128
+extern const unsigned short recip_table[RECIP_MIN];
+
 #endif